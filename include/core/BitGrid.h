@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class BitGrid
+{
+public:
+    BitGrid(int width = 0, int height = 0);
+
+    void resize(int width, int height);
+    void clear();
+    bool any() const;
+    int count() const;
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getWordsPerColumn() const { return wordsPerColumn; }
+
+    bool test(int row, int col) const
+    {
+        return (words[col * wordsPerColumn + (row >> 6)] >> (row & 63)) & 1;
+    }
+
+    void set(int row, int col)
+    {
+        words[col * wordsPerColumn + (row >> 6)] |= uint64_t(1) << (row & 63);
+    }
+
+    void reset(int row, int col)
+    {
+        words[col * wordsPerColumn + (row >> 6)] &= ~(uint64_t(1) << (row & 63));
+    }
+
+    uint64_t *getColumn(int col) { return words.data() + col * wordsPerColumn; }
+    const uint64_t *getColumn(int col) const { return words.data() + col * wordsPerColumn; }
+    bool anyInColumn(int col) const;
+    int countInColumn(int col) const;
+
+    int lastSetInColumn(int col, int end) const;
+    int lastClearInColumn(int col, int end) const;
+
+    void setColumnPrefix(int col, int count);
+
+    BitGrid &operator|=(const BitGrid &other);
+
+    static int highestBit(uint64_t word);
+
+private:
+    int width;
+    int height;
+    int wordsPerColumn;
+    std::vector<uint64_t> words;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <vector>
+#include "core/BitGrid.h"
+#include "core/Board.h"
+#include "core/BoardEngine.h"
+
+class BitboardMatcher : public BoardEngine
+{
+public:
+    bool findMatches(const Board &board, int numColors, BitGrid &mask) override;
+    bool hasAnyMove(const Board &board, int numColors) override;
+
+private:
+    std::vector<BitGrid> colorBits;
+
+    void buildColorBits(const Board &board, int numColors);
+    void markVerticalRuns(const BitGrid &bits, BitGrid &mask) const;
+    void markHorizontalRuns(const BitGrid &bits, BitGrid &mask) const;
+    bool hasMoveForColor(const BitGrid &bits) const;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "core/BitGrid.h"
+
+class Board
+{
+public:
+    class RowView
+    {
+    public:
+        RowView(const uint8_t *base, int stride, int size) : base(base), stride(stride), size(size) {}
+
+        uint8_t operator[](int col) const { return base[col * stride]; }
+        int getSize() const { return size; }
+
+    private:
+        const uint8_t *base;
+        int stride;
+        int size;
+    };
+
+    Board(int width = 0, int height = 0);
+
+    void resize(int width, int height);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    uint8_t getColor(int row, int col) const { return cells[col * height + row]; }
+    void setColor(int row, int col, uint8_t color)
+    {
+        if (hashing)
+        {
+            hash ^= getStateKey(row, col) ^ getCellKey(col * height + row, color);
+        }
+        cells[col * height + row] = color;
+        emptyMask.reset(row, col);
+    }
+
+    bool isEmpty(int row, int col) const { return emptyMask.test(row, col); }
+    void setEmpty(int row, int col)
+    {
+        if (hashing)
+        {
+            hash ^= getStateKey(row, col) ^ getCellKey(col * height + row, emptyState);
+        }
+        emptyMask.set(row, col);
+    }
+
+    const uint8_t *getColumn(int col) const { return cells.data() + col * height; }
+    uint8_t *getColumn(int col) { return cells.data() + col * height; }
+    RowView getRow(int row) const { return RowView(cells.data() + row, height, width); }
+
+    const BitGrid &getEmptyMask() const { return emptyMask; }
+    BitGrid &getEmptyMask() { return emptyMask; }
+
+    void swapCells(int row1, int col1, int row2, int col2);
+
+    // Zobrist hash of the board: the XOR of one key per cell, picked by the
+    // cell's color or by its being empty. Only with hashing on is it kept
+    // current, by the setters above and by code that writes columns or the
+    // empty mask directly, which folds in the keys of the cells it changed
+    // with toggleHash or calls rehash. Otherwise getHash scans the board.
+    void setHashing(bool enabled);
+    bool isHashing() const { return hashing; }
+    uint64_t getHash() const { return hashing ? hash : computeHash(); }
+    void toggleHash(uint64_t keys) { hash ^= keys; }
+    void rehash()
+    {
+        if (hashing)
+        {
+            hash = computeHash();
+        }
+    }
+    uint64_t computeHash() const;
+    uint64_t computeColumnHash(int col, int begin, int end) const;
+
+    uint64_t computeCanonicalHash() const;
+
+    static const int emptyState = 256;
+
+    static uint64_t getCellKey(int cell, int state)
+    {
+        uint64_t z = static_cast<uint64_t>(cell) * 512 + static_cast<uint64_t>(state) + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t getStateKey(int row, int col) const
+    {
+        return getCellKey(col * height + row, isEmpty(row, col) ? emptyState : getColor(row, col));
+    }
+
+private:
+    uint64_t computeRelabeledHash(bool mirrored) const;
+
+    int width;
+    int height;
+    std::vector<uint8_t> cells;
+    BitGrid emptyMask;
+    bool hashing = false;
+    uint64_t hash = 0;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <memory>
+#include "core/BitGrid.h"
+#include "core/Board.h"
+
+class BoardEngine
+{
+public:
+    virtual ~BoardEngine() = default;
+
+    virtual bool findMatches(const Board &board, int numColors, BitGrid &mask) = 0;
+    virtual bool hasAnyMove(const Board &board, int numColors) = 0;
+    virtual bool isSpecialized() const { return false; }
+
+    static std::unique_ptr<BoardEngine> create(int width, int height, int numColors);
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct BoardConfig
+{
+    int width = 0;
+    int height = 0;
+    int numColors = 0;
+    std::vector<int> colors;
+
+    bool operator==(const BoardConfig &other) const
+    {
+        return width == other.width && height == other.height && numColors == other.numColors &&
+               colors == other.colors;
+    }
+    bool operator!=(const BoardConfig &other) const { return !(*this == other); }
+};
+
+class BoardPool
+{
+public:
+    explicit BoardPool(int workerCount = 1, std::size_t capacity = 4);
+    ~BoardPool();
+
+    BoardPool(const BoardPool &) = delete;
+    BoardPool &operator=(const BoardPool &) = delete;
+
+    void setConfig(const BoardConfig &config);
+    bool take(const BoardConfig &config, std::vector<uint8_t> &colors);
+
+private:
+    std::size_t capacity;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    BoardConfig config;
+    uint64_t generation = 0;
+    std::deque<std::vector<uint8_t>> ready;
+    std::size_t inProgress = 0;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    bool needsBoard() const;
+    void run();
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct CascadeStep
+{
+    int clearedBegin;
+    int clearedEnd;
+    int fallBegin;
+    int fallEnd;
+    int spawnBegin;
+    int spawnEnd;
+};
+
+struct TileFall
+{
+    int cell;
+    int distance;
+};
+
+struct TileSpawn
+{
+    int cell;
+    uint8_t color;
+};
+
+class CascadeTrace
+{
+public:
+    void reset(int width, int height);
+
+    void beginStep();
+    void addCleared(int cell) { cleared.push_back(cell); }
+    void addFall(int cell, int distance) { falls.push_back(TileFall{cell, distance}); }
+    void addSpawn(int cell, uint8_t color) { spawns.push_back(TileSpawn{cell, color}); }
+    void endStep();
+    void append(const CascadeTrace &other);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getRow(int cell) const { return cell % height; }
+    int getColumn(int cell) const { return cell / height; }
+
+    int getStepCount() const { return static_cast<int>(steps.size()); }
+    const CascadeStep &getStep(int index) const { return steps[index]; }
+    const std::vector<int> &getCleared() const { return cleared; }
+    const std::vector<TileFall> &getFalls() const { return falls; }
+    const std::vector<TileSpawn> &getSpawns() const { return spawns; }
+
+private:
+    int width = 0;
+    int height = 0;
+    std::vector<CascadeStep> steps;
+    std::vector<int> cleared;
+    std::vector<TileFall> falls;
+    std::vector<TileSpawn> spawns;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+class DirtyRegion
+{
+public:
+    DirtyRegion(int width = 0, int height = 0);
+
+    void resize(int width, int height);
+    void markCell(int row, int col);
+    void markColumnRange(int col, int begin, int end);
+    void markAll();
+    void clear();
+
+    bool isEmpty() const { return rows.empty() && !full; }
+    bool isFull() const { return full; }
+
+    const std::vector<int> &getRows() const { return rows; }
+    const std::vector<int> &getColumns() const { return columns; }
+    int getRowBegin(int row) const { return rowSpans[row].begin; }
+    int getRowEnd(int row) const { return rowSpans[row].end; }
+    int getColumnBegin(int col) const { return columnSpans[col].begin; }
+    int getColumnEnd(int col) const { return columnSpans[col].end; }
+
+private:
+    struct Span
+    {
+        int begin;
+        int end;
+    };
+
+    int width;
+    int height;
+    bool full;
+    std::vector<Span> rowSpans;
+    std::vector<Span> columnSpans;
+    std::vector<int> rows;
+    std::vector<int> columns;
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "core/BoardEngine.h"
+
+template <int W, int H, int MaxColors>
+class FixedBoardEngine final : public BoardEngine
+{
+    static_assert(W >= 3 && H >= 3 && H <= 64, "columns must fit in one word");
+
+public:
+    static constexpr uint64_t columnMask = (H == 64) ? ~uint64_t(0) : ((uint64_t(1) << H) - 1);
+
+    bool findMatches(const Board &board, int numColors, BitGrid &mask) override;
+    bool hasAnyMove(const Board &board, int numColors) override;
+    bool isSpecialized() const override { return true; }
+
+private:
+    using ColumnBits = std::array<uint64_t, W>;
+
+    std::array<ColumnBits, MaxColors> colorBits;
+
+    void buildColorBits(const Board &board, int numColors);
+    static bool hasMoveForColor(const ColumnBits &x);
+};
+
+template <int W, int H, int MaxColors>
+void FixedBoardEngine<W, H, MaxColors>::buildColorBits(const Board &board, int numColors)
+{
+    for (int c = 0; c < numColors; c++)
+    {
+        colorBits[c].fill(0);
+    }
+
+    const BitGrid &emptyMask = board.getEmptyMask();
+    for (int j = 0; j < W; j++)
+    {
+        const uint8_t *column = board.getColumn(j);
+        uint64_t filled = ~emptyMask.getColumn(j)[0] & columnMask;
+
+        for (int i = 0; i < H; i++)
+        {
+            if (column[i] < numColors)
+            {
+                colorBits[column[i]][j] |= filled & (uint64_t(1) << i);
+            }
+        }
+    }
+}
+
+template <int W, int H, int MaxColors>
+bool FixedBoardEngine<W, H, MaxColors>::findMatches(const Board &board, int numColors, BitGrid &mask)
+{
+    if (mask.getWidth() != W || mask.getHeight() != H)
+    {
+        mask.resize(W, H);
+    }
+
+    buildColorBits(board, numColors);
+
+    ColumnBits out{};
+    for (int c = 0; c < numColors; c++)
+    {
+        const ColumnBits &x = colorBits[c];
+
+        for (int j = 0; j < W; j++)
+        {
+            uint64_t starts = x[j] & (x[j] >> 1) & (x[j] >> 2);
+            out[j] |= starts | (starts << 1) | (starts << 2);
+        }
+        for (int j = 0; j + 2 < W; j++)
+        {
+            uint64_t starts = x[j] & x[j + 1] & x[j + 2];
+            out[j] |= starts;
+            out[j + 1] |= starts;
+            out[j + 2] |= starts;
+        }
+    }
+
+    uint64_t any = 0;
+    for (int j = 0; j < W; j++)
+    {
+        mask.getColumn(j)[0] = out[j];
+        any |= out[j];
+    }
+    return any != 0;
+}
+
+template <int W, int H, int MaxColors>
+bool FixedBoardEngine<W, H, MaxColors>::hasAnyMove(const Board &board, int numColors)
+{
+    buildColorBits(board, numColors);
+
+    for (int c = 0; c < numColors; c++)
+    {
+        if (hasMoveForColor(colorBits[c]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <int W, int H, int MaxColors>
+bool FixedBoardEngine<W, H, MaxColors>::hasMoveForColor(const ColumnBits &x)
+{
+    for (int j = 0; j < W; j++)
+    {
+        uint64_t left = (j >= 1) ? x[j - 1] : 0;
+        uint64_t left2 = (j >= 2) ? x[j - 2] : 0;
+        uint64_t right = (j + 1 < W) ? x[j + 1] : 0;
+        uint64_t right2 = (j + 2 < W) ? x[j + 2] : 0;
+        uint64_t right3 = (j + 3 < W) ? x[j + 3] : 0;
+        uint64_t sides = left | right;
+
+        uint64_t pair = x[j] & (x[j] >> 1);
+        if (pair & ((x[j] >> 3) | (sides >> 2) | (x[j] << 2) | (sides << 1)))
+        {
+            return true;
+        }
+
+        uint64_t split = x[j] & (x[j] >> 2);
+        if (split & (sides >> 1))
+        {
+            return true;
+        }
+
+        if (j + 1 >= W)
+        {
+            continue;
+        }
+
+        uint64_t targets = 0;
+        if (j + 2 < W)
+        {
+            targets |= right3 | (right2 >> 1) | (right2 << 1);
+        }
+        if (j >= 1)
+        {
+            targets |= left2 | (left >> 1) | (left << 1);
+        }
+        if (x[j] & right & targets)
+        {
+            return true;
+        }
+
+        if (x[j] & right2 & ((right >> 1) | (right << 1)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+extern template class FixedBoardEngine<8, 8, 10>;
+extern template class FixedBoardEngine<9, 9, 10>;
+extern template class FixedBoardEngine<10, 10, 10>;
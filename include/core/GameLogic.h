@@ -1,17 +1,27 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <memory>
+#include <string>
 #include <vector>
+#include "core/BitboardMatcher.h"
+#include "core/Board.h"
+#include "core/BoardEngine.h"
+#include "core/CascadeTrace.h"
+#include "core/DirtyRegion.h"
+#include "core/GridPos.h"
+#include "core/MatchKernels.h"
+#include "core/MatchResult.h"
+#include "core/Rng.h"
+#include "core/ScanMatcher.h"
+#include "core/ThreadPool.h"
 
-struct Tile
+struct Move
 {
-    int colorIndex;
-    bool isEmpty = false;
-};
-
-struct Match
-{
-    std::vector<sf::Vector2i> positions;
+    int row1;
+    int col1;
+    int row2;
+    int col2;
 };
 
 class GameLogic
@@ -19,26 +29,97 @@ class GameLogic
 public:
     GameLogic(int width, int height, int numColors);
 
-    void initialize();
+    bool initialize();
+    void randomize();
     int getWidth() const { return width; }
     int getHeight() const { return height; }
     int getColorIndex(int row, int col) const;
     bool isEmpty(int row, int col) const;
     const std::vector<int> &getAvailableColors() const { return availableColorIndices; }
+    void setAvailableColors(const std::vector<int> &colorIndices);
+    const Board &getBoard() const { return board; }
+    std::string getMatchEngineName() const;
+    void setColors(const std::vector<uint8_t> &colors);
+    void setHashing(bool enabled) { board.setHashing(enabled); }
+    uint64_t getHash() const { return board.getHash(); }
+    uint64_t getCanonicalHash() const { return board.computeCanonicalHash(); }
     
-    std::vector<Match> findMatches();
-    void clearMatches(const std::vector<Match> &matches);
-    std::vector<sf::Vector2i> applyGravity();
+    bool findMatches(MatchResult &result);
+    bool findMatchesInDirtyRegion(MatchResult &result);
+    bool findMatchesReference(MatchResult &result);
+    const DirtyRegion &getDirtyRegion() const { return dirtyRegion; }
+    void clearMatches(const MatchResult &result);
+    std::vector<GridPos> applyGravity();
     void fillEmptySpaces();
+    std::vector<GridPos> applyGravityReference();
+    void fillEmptySpacesReference();
     void swapTiles(int row1, int col1, int row2, int col2);
+    bool resolveStep(CascadeTrace &trace);
+    int resolveCascade(CascadeTrace &trace, int maxSteps = 1000);
+    int resolveCascade(int maxSteps = 1000);
+    bool hasAnyMove();
+    int scoreSwap(int row1, int col1, int row2, int col2) const;
+    void findValidMoves(std::vector<Move> &moves) const;
+    bool reshuffle();
+
+    void setRng(std::shared_ptr<Rng> newRng);
+    Rng &getRng() { return *rng; }
+    void seed(uint64_t seed);
+    uint64_t getSeed() const { return seedValue; }
+
+    static void setMatchKernel(MatchKernel kernel);
+    static MatchKernel getMatchKernel();
+
+    void setThreadPool(ThreadPool *pool) { threadPool = pool; }
+    static constexpr int parallelMinCells = 1 << 16;
+    static constexpr int bandColumns = 16;
 
 private:
     int width;
     int height;
     int numColors;
-    std::vector<std::vector<Tile>> grid;
+    Board board;
+    std::unique_ptr<BoardEngine> engine;
+    ScanMatcher scanMatcher;
+    DirtyRegion dirtyRegion;
     std::vector<int> availableColorIndices;
+    std::vector<uint8_t> shuffleColors;
+    std::vector<uint8_t> refillColors;
+    std::shared_ptr<Rng> rng;
+    uint64_t seedValue;
+    MatchResult reshuffleResult;
+    MatchResult stepResult;
+    ThreadPool *threadPool = nullptr;
+    std::vector<uint64_t> bandSeeds;
+    std::vector<ScanMatcher> bandMatchers;
+    std::vector<CascadeTrace> bandTraces;
+    std::vector<uint8_t> changedColumns;
     
-    void findHorizontalMatches(std::vector<Match> &matches);
-    void findVerticalMatches(std::vector<Match> &matches);
+    void generateMatchFree();
+    void findHorizontalMatches(MatchResult &result);
+    void findVerticalMatches(MatchResult &result);
+    void collectRuns(MatchResult &result) const;
+    void markRowRuns(int row, int begin, int end, MatchResult &result) const;
+    void markColumnRuns(int col, int begin, int end, MatchResult &result) const;
+    bool isSameTile(int row1, int col1, int row2, int col2) const;
+    bool completesRun(int row, int col, uint8_t color) const;
+    int colorAfterSwap(int row, int col, const Move &move) const;
+    int runScoreAfterSwap(int row, int col, const Move &move) const;
+    // These write the board directly and XOR the Zobrist keys they change
+    // into hashChange, so bands can run them without sharing the hash.
+    uint64_t clearColumn(int col, const BitGrid &mask);
+    bool collapseColumn(int col, uint64_t &hashChange, CascadeTrace *trace, DirtyRegion *dirty);
+    uint64_t hashEmptyFlips(int col, int prefix) const;
+    void refillColumn(int col, Rng &colorRng, std::vector<uint8_t> &colors, uint64_t &hashChange, CascadeTrace *trace,
+                      DirtyRegion *dirty);
+
+    bool isParallel() const;
+    bool usesBoardEngine() const;
+    int getBandCount() const { return (width + bandColumns - 1) / bandColumns; }
+    int getBandEnd(int band) const { return std::min(width, (band + 1) * bandColumns); }
+    void drawBandSeeds();
+    bool resolveStep(CascadeTrace *trace);
+    void resolveStepInBands(CascadeTrace *trace);
+    void traceCleared(int col, const BitGrid &mask, CascadeTrace &trace) const;
+    bool hasAnyMoveScan() const;
 };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/BoardPool.h"
+#include "core/GameLogic.h"
+#include "core/SpscQueue.h"
+#include "core/TripleBuffer.h"
+
+enum class SimCommandType
+{
+    Prepare,
+    Start,
+    Swap
+};
+
+struct SimCommand
+{
+    SimCommandType type = SimCommandType::Start;
+    uint64_t sequence = 0;
+    BoardConfig config;
+    Move move = Move{0, 0, 0, 0};
+};
+
+struct BoardSnapshot
+{
+    uint64_t sequence = 0;
+    int width = 0;
+    int height = 0;
+    bool swapValid = false;
+    bool reshuffled = false;
+    std::vector<int> availableColors;
+    std::vector<int> initialColors;
+    std::vector<int> finalColors;
+    CascadeTrace trace;
+};
+
+class GameSimulation
+{
+public:
+    GameSimulation();
+    ~GameSimulation();
+
+    GameSimulation(const GameSimulation &) = delete;
+    GameSimulation &operator=(const GameSimulation &) = delete;
+
+    bool prepare(const BoardConfig &config);
+
+    uint64_t start(const BoardConfig &config);
+    uint64_t requestSwap(const Move &move);
+
+    bool pollSnapshot() { return snapshots.update(); }
+    const BoardSnapshot &getSnapshot() const { return snapshots.front(); }
+
+private:
+    SpscQueue<SimCommand, 16> commands;
+    TripleBuffer<BoardSnapshot> snapshots;
+    uint64_t nextSequence = 1;
+
+    BoardPool boardPool;
+    std::vector<uint8_t> pooledColors;
+    std::unique_ptr<GameLogic> logic;
+    MatchResult swapResult;
+    std::atomic<bool> stopping{false};
+    std::mutex wakeMutex;
+    std::condition_variable wakeup;
+    std::thread thread;
+
+    uint64_t submit(SimCommand &command);
+    void run();
+    void execute(const SimCommand &command);
+    void copyColors(std::vector<int> &colors) const;
+};
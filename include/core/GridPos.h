@@ -0,0 +1,13 @@
+#pragma once
+
+struct GridPos
+{
+    int x;
+    int y;
+
+    GridPos() : x(0), y(0) {}
+    GridPos(int x, int y) : x(x), y(y) {}
+
+    bool operator==(const GridPos &other) const { return x == other.x && y == other.y; }
+    bool operator!=(const GridPos &other) const { return !(*this == other); }
+};
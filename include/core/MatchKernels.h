@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+enum class MatchKernel
+{
+    Auto,
+    Bitboard,
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+using TripleScanFn = void (*)(const uint8_t *a, const uint8_t *b, const uint8_t *c, int count, uint64_t *out);
+
+class MatchKernels
+{
+public:
+    static MatchKernel detectBest();
+    static bool isSupported(MatchKernel kernel);
+    static TripleScanFn getTripleScan(MatchKernel kernel);
+    static const char *getName(MatchKernel kernel);
+};
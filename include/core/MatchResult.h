@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include "core/BitGrid.h"
+#include "core/GridPos.h"
+
+struct MatchRun
+{
+    int offset;
+    int length;
+    bool horizontal;
+};
+
+class MatchResult
+{
+public:
+    void reset(int width, int height);
+    void addRun(int row, int col, int length, bool horizontal);
+
+    void setMaskOnly(bool found)
+    {
+        maskOnly = true;
+        maskFound = found;
+    }
+    bool hasRuns() const { return !maskOnly; }
+
+    bool empty() const { return maskOnly ? !maskFound : runs.empty(); }
+    const std::vector<MatchRun> &getRuns() const { return runs; }
+    const std::vector<GridPos> &getPositions() const { return positions; }
+    const BitGrid &getMask() const { return mask; }
+    BitGrid &getMask() { return mask; }
+
+private:
+    BitGrid mask;
+    std::vector<GridPos> positions;
+    std::vector<MatchRun> runs;
+    bool maskOnly = false;
+    bool maskFound = false;
+};
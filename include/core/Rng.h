@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+class Rng
+{
+public:
+    virtual ~Rng() = default;
+
+    virtual void seed(uint64_t seed) = 0;
+    virtual uint64_t next() = 0;
+    virtual void drawColors(uint8_t *out, int count, int numColors);
+
+    uint32_t nextBelow(uint32_t bound) { return static_cast<uint32_t>(((next() >> 32) * bound) >> 32); }
+
+    static uint64_t generateSeed();
+};
+
+class Xoshiro256Rng : public Rng
+{
+public:
+    explicit Xoshiro256Rng(uint64_t seed = 0);
+
+    void seed(uint64_t seed) override;
+    uint64_t next() override { return step(); }
+    void drawColors(uint8_t *out, int count, int numColors) override;
+
+private:
+    uint64_t state[4];
+
+    uint64_t step()
+    {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
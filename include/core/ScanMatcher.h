@@ -0,0 +1,16 @@
+#pragma once
+
+#include <vector>
+#include "core/BitGrid.h"
+#include "core/Board.h"
+#include "core/MatchKernels.h"
+
+class ScanMatcher
+{
+public:
+    bool findMatches(const Board &board, TripleScanFn scan, BitGrid &mask);
+    bool findMatchesInColumns(const Board &board, TripleScanFn scan, BitGrid &mask, int begin, int end);
+
+private:
+    std::vector<uint64_t> starts;
+};
@@ -17,8 +17,13 @@ public:
     virtual void update(float deltaTime) {}
     virtual void render(sf::RenderWindow &window) = 0;
 
+    virtual bool isAnimating() const { return false; }
+
     void setSceneManager(SceneManager *manager) { sceneManager = manager; }
 
+    void setInterpolation(float alpha) { interpolation = alpha; }
+
 protected:
     SceneManager *sceneManager = nullptr;
+    float interpolation = 1.0f;
 };
@@ -19,9 +19,10 @@ public:
 
     void handleEvent(const sf::Event &event);
     void update(float deltaTime);
-    void render();
+    void render(float interpolation = 1.0f);
 
     bool hasActiveScene() const;
+    bool isAnimating() const;
 
 private:
     sf::RenderWindow &window;
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// One writer, one reader, neither ever waits. Each side trades its buffer
+// for the middle one with an acq_rel exchange, so the writes to back() made
+// before publish() are visible once update() has seen the fresh bit.
+template <typename T>
+class TripleBuffer
+{
+public:
+    T &back() { return buffers[backIndex]; }
+
+    void publish()
+    {
+        backIndex = middle.exchange(static_cast<uint8_t>(backIndex | freshBit), std::memory_order_acq_rel) & indexMask;
+    }
+
+    bool update()
+    {
+        if (!(middle.load(std::memory_order_relaxed) & freshBit))
+        {
+            return false;
+        }
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & indexMask;
+        return true;
+    }
+
+    const T &front() const { return buffers[frontIndex]; }
+
+private:
+    static constexpr uint8_t indexMask = 0x3;
+    static constexpr uint8_t freshBit = 0x4;
+
+    T buffers[3];
+    uint8_t backIndex = 0;
+    std::atomic<uint8_t> middle{1};
+    uint8_t frontIndex = 2;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class BoardBackground
+{
+public:
+    BoardBackground();
+
+    void build(int width, int height, float tileSize);
+    bool isBuiltFor(int width, int height, float tileSize) const;
+    void draw(sf::RenderTarget &target) const;
+
+private:
+    int width = 0;
+    int height = 0;
+    float tileSize = 0.f;
+
+    std::vector<sf::Vertex> vertices;
+    sf::VertexBuffer buffer;
+    bool useBuffer = false;
+
+    void addRect(const sf::Vector2f &position, const sf::Vector2f &size, const sf::Color &color);
+};
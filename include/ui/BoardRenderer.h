@@ -0,0 +1,27 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "ui/TileAtlas.h"
+#include "utils/RoundedRectangle.h"
+
+class BoardRenderer
+{
+public:
+    BoardRenderer();
+
+    void setAtlas(const TileAtlas *tileAtlas) { atlas = tileAtlas; }
+
+    void clear();
+    void addTile(int colorIndex, const sf::Vector2f &position, float scale = 1.0f);
+    void draw(sf::RenderTarget &target) const;
+
+    std::size_t getVertexCount() const { return vertices.getVertexCount(); }
+
+private:
+    const TileAtlas *atlas = nullptr;
+    sf::VertexArray vertices;
+    RoundedRectangle fallbackShape;
+
+    void addTexturedTile(int colorIndex, const sf::Vector2f &center, float scale);
+    void addShapeTile(int colorIndex, const sf::Vector2f &center, float scale);
+};
@@ -3,12 +3,16 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include "core/Scene.h"
-#include "core/GameLogic.h"
-#include "utils/RoundedRectangle.h"
+#include "core/GameSimulation.h"
+#include "ui/BoardBackground.h"
+#include "ui/BoardRenderer.h"
+#include "ui/TileAtlas.h"
+#include "utils/TweenSystem.h"
 
 enum class GameState
 {
     Idle,
+    Loading,
     Swapping,
     FallingInitial,
     CheckingMatches,
@@ -16,6 +20,13 @@ enum class GameState
     FallingAfterClear
 };
 
+struct TileSprite
+{
+    sf::Vector2f position;
+    sf::Vector2f previousPosition;
+    int colorIndex = -1;
+};
+
 class GameBoard : public Scene
 {
 public:
@@ -23,23 +34,37 @@ public:
 
     void onEnter() override;
     void handleEvent(const sf::Event &event) override;
+    void update(float deltaTime) override;
     void render(sf::RenderWindow &window) override;
+    bool isAnimating() const override;
 
 private:
     float windowSize;
-    std::shared_ptr<GameLogic> gameLogic;
-    std::vector<std::vector<RoundedRectangle>> shapes;
+    GameSimulation simulation;
+    int boardWidth = 0;
+    int boardHeight = 0;
+    std::vector<std::vector<TileSprite>> tiles;
+    TileAtlas tileAtlas;
+    BoardBackground background;
+    BoardRenderer boardRenderer;
+
+    uint64_t awaitingSequence = 0;
+    uint64_t snapshotSequence = 0;
+    int nextCascadeStep = 0;
+    bool reshufflePending = false;
 
-    std::vector<std::vector<sf::Vector2f>> targetPositions;
-    std::vector<std::vector<sf::Vector2f>> startPositions;
-    sf::Clock animationClock;
+    TweenSystem tweens;
+    std::vector<int> movedTiles;
+    float simulationTime = 0.0f;
+    std::vector<int> spawnCounts;
     GameState gameState = GameState::Idle;
 
     sf::Vector2i selectedTile = sf::Vector2i(-1, -1);
     sf::Vector2i swapTile1 = sf::Vector2i(-1, -1);
     sf::Vector2i swapTile2 = sf::Vector2i(-1, -1);
     bool isSwapReversing = false;
-    sf::Clock scaleClock;
+    float scaleTime = 0.0f;
+    float previousScaleTime = 0.0f;
     float currentScale = 1.0f;
     float targetScale = 1.0f;
     sf::Vector2i scalingTile = sf::Vector2i(-1, -1);
@@ -56,12 +81,20 @@ private:
     void initializeShapes();
     void drawGrid(sf::RenderWindow &window);
     void updateAnimation();
-    void startFallAnimation(const std::vector<sf::Vector2i> &affectedTiles = {});
+    void settleMovedTiles();
+    void updateScale(float deltaTime);
+    sf::Vector2f getDrawPosition(const TileSprite &tile) const;
+    bool receiveSnapshot();
+    void beginReplay();
+    void startFallAnimation(const std::vector<int> &colors);
     void checkAndClearMatches();
+    void addTween(int row, int col, const sf::Vector2f &start, float duration, Easing easing);
+    void swapTileSprites(const sf::Vector2i &tile1, const sf::Vector2i &tile2);
     void handleTileClick(int row, int col);
     void startSwapAnimation(const sf::Vector2i &tile1, const sf::Vector2i &tile2);
     bool areAdjacent(const sf::Vector2i &tile1, const sf::Vector2i &tile2) const;
-    void drawSelectedHighlight(sf::RenderWindow &window);
+    void addSelectedHighlight();
     float getTileSize() const;
     float getPadding() const;
+    sf::Vector2f getTilePosition(int row, int col) const;
 };
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class PerfOverlay
+{
+public:
+    PerfOverlay();
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+    void draw(sf::RenderTarget &target);
+
+private:
+    bool visible = false;
+    sf::Font font;
+    bool hasFont = false;
+    std::vector<sf::Vertex> vertices;
+
+    void addRect(const sf::Vector2f &position, const sf::Vector2f &size, const sf::Color &color);
+    void drawText(sf::RenderTarget &target, const sf::Vector2f &position);
+};
@@ -2,6 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "core/Rng.h"
 #include "core/Scene.h"
 #include "utils/RoundedRectangle.h"
 
@@ -33,6 +34,7 @@ private:
 
     int numColors;
     sf::Vector2i gridSize;
+    Xoshiro256Rng rng;
 
     void renderColorSelector(sf::RenderWindow &window);
     void renderGridSelector(sf::RenderWindow &window);
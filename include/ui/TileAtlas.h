@@ -0,0 +1,27 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+class TileAtlas
+{
+public:
+    bool build(float shapeSize, float cornerRadius, float selectedScale);
+
+    bool isValid() const { return valid; }
+    const sf::Texture &getTexture() const { return texture.getTexture(); }
+    sf::FloatRect getTextureRect(int colorIndex, bool selected) const;
+
+    float getShapeSize() const { return shapeSize; }
+    float getCornerRadius() const { return cornerRadius; }
+    float getSelectedScale() const { return selectedScale; }
+    float getCellSize() const { return cellSize; }
+
+private:
+    sf::RenderTexture texture;
+    bool valid = false;
+    float shapeSize = 0.f;
+    float cornerRadius = 0.f;
+    float selectedScale = 1.f;
+    float cellSize = 0.f;
+    int colorCount = 0;
+};
@@ -8,7 +8,8 @@ enum class GlobalKey
 {
     Backspace,
     Space,
-    Enter
+    Enter,
+    F3
 };
 
 class KeyboardMonitor
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+
+enum class PerfPhase
+{
+    Events,
+    Update,
+    Render,
+    Display,
+    Count
+};
+
+class PerfStats
+{
+public:
+    static constexpr int historySize = 240;
+    static constexpr int phaseCount = static_cast<int>(PerfPhase::Count);
+
+    static PerfStats &getInstance();
+
+    void beginFrame();
+    void endFrame();
+    void addPhaseTime(PerfPhase phase, float milliseconds);
+
+    void setActiveAnimations(int count) { activeAnimations = count; }
+    void setGameState(const char *state) { gameState = state; }
+
+    float getFramePercentile(float p) const;
+    float getPhasePercentile(PerfPhase phase, float p) const;
+    float getFrameTime(int framesAgo) const;
+    int getRecordedFrames() const { return recordedFrames; }
+    int getActiveAnimations() const { return activeAnimations; }
+    const char *getGameState() const { return gameState; }
+
+private:
+    PerfStats() = default;
+    PerfStats(const PerfStats &) = delete;
+    PerfStats &operator=(const PerfStats &) = delete;
+
+    float phaseHistory[phaseCount][historySize] = {};
+    float frameHistory[historySize] = {};
+    float currentPhases[phaseCount] = {};
+    int nextFrame = 0;
+    int recordedFrames = 0;
+    int activeAnimations = 0;
+    const char *gameState = nullptr;
+
+    float percentile(const float *history, float p) const;
+};
+
+class PerfScope
+{
+public:
+    explicit PerfScope(PerfPhase phase) : phase(phase), start(std::chrono::steady_clock::now()) {}
+    ~PerfScope()
+    {
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        PerfStats::getInstance().addPhaseTime(phase, elapsed.count());
+    }
+
+private:
+    PerfPhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+#ifdef MATCH3_PERF_OVERLAY
+#define MATCH3_PERF_SCOPE(phase) PerfScope perfScope##phase(PerfPhase::phase)
+#define MATCH3_PERF_BEGIN_FRAME() PerfStats::getInstance().beginFrame()
+#define MATCH3_PERF_END_FRAME() PerfStats::getInstance().endFrame()
+#define MATCH3_PERF_SET_ANIMATIONS(count) PerfStats::getInstance().setActiveAnimations(static_cast<int>(count))
+#define MATCH3_PERF_SET_STATE(state) PerfStats::getInstance().setGameState(state)
+#else
+#define MATCH3_PERF_SCOPE(phase) ((void)0)
+#define MATCH3_PERF_BEGIN_FRAME() ((void)0)
+#define MATCH3_PERF_END_FRAME() ((void)0)
+#define MATCH3_PERF_SET_ANIMATIONS(count) ((void)0)
+#define MATCH3_PERF_SET_STATE(state) ((void)0)
+#endif
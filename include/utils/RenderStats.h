@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+class RenderStats
+{
+public:
+    static RenderStats &getInstance();
+
+    void beginFrame()
+    {
+#ifdef MATCH3_PERF_OVERLAY
+        lastDrawCalls = drawCalls;
+        lastVertexCount = vertexCount;
+        drawCalls = 0;
+        vertexCount = 0;
+#endif
+    }
+
+    void recordDraw(std::size_t vertices)
+    {
+#ifdef MATCH3_PERF_OVERLAY
+        drawCalls++;
+        vertexCount += vertices;
+#else
+        (void)vertices;
+#endif
+    }
+
+    int getDrawCalls() const { return lastDrawCalls; }
+    std::size_t getVertexCount() const { return lastVertexCount; }
+
+private:
+    RenderStats() = default;
+    RenderStats(const RenderStats &) = delete;
+    RenderStats &operator=(const RenderStats &) = delete;
+
+    int drawCalls = 0;
+    std::size_t vertexCount = 0;
+    int lastDrawCalls = 0;
+    std::size_t lastVertexCount = 0;
+};
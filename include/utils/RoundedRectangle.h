@@ -1,35 +1,39 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
 
-class RoundedRectangle : public sf::Drawable
+class RoundedRectangle : public sf::Drawable, public sf::Transformable
 {
 public:
     RoundedRectangle(const sf::Vector2f &size = sf::Vector2f(0, 0), float cornerRadius = 0.f);
 
     void setSize(const sf::Vector2f &size);
-    void setPosition(const sf::Vector2f &position);
     void setFillColor(const sf::Color &color);
     void setCornerRadius(float radius);
 
     sf::Vector2f getSize() const;
-    sf::Vector2f getPosition() const;
     sf::Color getFillColor() const;
     float getCornerRadius() const;
 
+    const std::vector<sf::Vector2f> &getOutline() const { return *outline; }
+
     sf::FloatRect getGlobalBounds() const;
 
     void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
 
 private:
+    using Outline = std::vector<sf::Vector2f>;
+
     sf::Vector2f size;
-    sf::Vector2f position;
     sf::Color fillColor;
     float cornerRadius;
 
-    sf::RectangleShape centerH;
-    sf::RectangleShape centerV;
-    sf::CircleShape corners[4];
+    std::shared_ptr<const Outline> outline;
+    sf::VertexArray vertices;
 
-    void updateShapes();
+    static std::shared_ptr<const Outline> getSharedOutline(const sf::Vector2f &size, float cornerRadius);
+    void updateGeometry();
+    void updateColors();
 };
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+enum class Easing : uint8_t
+{
+    Linear,
+    EaseInQuad
+};
+
+class TweenSystem
+{
+public:
+    void add(int entity, const sf::Vector2f &start, const sf::Vector2f &target, float startTime, float duration,
+             Easing easing = Easing::Linear);
+    void clear();
+
+    bool empty() const { return entities.empty(); }
+    std::size_t size() const { return entities.size(); }
+    bool isActive(int entity) const;
+
+    template <typename Apply>
+    void update(float now, Apply &&apply);
+
+private:
+    std::vector<int> entities;
+    std::vector<float> startX;
+    std::vector<float> startY;
+    std::vector<float> targetX;
+    std::vector<float> targetY;
+    std::vector<float> startTimes;
+    std::vector<float> durations;
+    std::vector<uint8_t> quadratic;
+
+    std::vector<float> currentX;
+    std::vector<float> currentY;
+    std::vector<uint8_t> finished;
+
+    std::vector<int> slots;
+
+    void interpolate(float now);
+    void retireFinished();
+};
+
+template <typename Apply>
+void TweenSystem::update(float now, Apply &&apply)
+{
+    if (entities.empty())
+    {
+        return;
+    }
+
+    interpolate(now);
+
+    for (std::size_t k = 0; k < entities.size(); k++)
+    {
+        apply(entities[k], sf::Vector2f(currentX[k], currentY[k]));
+    }
+
+    retireFinished();
+}
@@ -0,0 +1,143 @@
+#include "core/BitGrid.h"
+#include <algorithm>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+int BitGrid::highestBit(uint64_t word)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(word);
+#endif
+}
+
+static int bitCount(uint64_t word)
+{
+    int total = 0;
+    while (word != 0)
+    {
+        word &= word - 1;
+        total++;
+    }
+    return total;
+}
+
+BitGrid::BitGrid(int width, int height)
+    : width(0), height(0), wordsPerColumn(0)
+{
+    resize(width, height);
+}
+
+void BitGrid::resize(int newWidth, int newHeight)
+{
+    width = newWidth;
+    height = newHeight;
+    wordsPerColumn = (height + 63) / 64;
+    words.assign(width * wordsPerColumn, 0);
+}
+
+void BitGrid::clear()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+bool BitGrid::any() const
+{
+    for (uint64_t word : words)
+    {
+        if (word != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int BitGrid::count() const
+{
+    int total = 0;
+    for (uint64_t word : words)
+    {
+        total += bitCount(word);
+    }
+    return total;
+}
+
+bool BitGrid::anyInColumn(int col) const
+{
+    const uint64_t *column = getColumn(col);
+    for (int w = 0; w < wordsPerColumn; w++)
+    {
+        if (column[w] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+BitGrid &BitGrid::operator|=(const BitGrid &other)
+{
+    for (size_t i = 0; i < words.size(); i++)
+    {
+        words[i] |= other.words[i];
+    }
+    return *this;
+}
+
+int BitGrid::countInColumn(int col) const
+{
+    const uint64_t *column = getColumn(col);
+    int total = 0;
+    for (int w = 0; w < wordsPerColumn; w++)
+    {
+        total += bitCount(column[w]);
+    }
+    return total;
+}
+
+static int lastInColumn(const uint64_t *column, int end, uint64_t flip)
+{
+    if (end <= 0)
+    {
+        return -1;
+    }
+
+    int w = (end - 1) >> 6;
+    int bits = end - (w << 6);
+    uint64_t word = (column[w] ^ flip) & (bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1);
+
+    while (word == 0)
+    {
+        if (--w < 0)
+        {
+            return -1;
+        }
+        word = column[w] ^ flip;
+    }
+    return (w << 6) + BitGrid::highestBit(word);
+}
+
+int BitGrid::lastSetInColumn(int col, int end) const
+{
+    return lastInColumn(getColumn(col), end, 0);
+}
+
+int BitGrid::lastClearInColumn(int col, int end) const
+{
+    return lastInColumn(getColumn(col), end, ~uint64_t(0));
+}
+
+void BitGrid::setColumnPrefix(int col, int count)
+{
+    uint64_t *column = getColumn(col);
+    for (int w = 0; w < wordsPerColumn; w++)
+    {
+        int bits = std::min(std::max(count - (w << 6), 0), 64);
+        column[w] = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+    }
+}
@@ -0,0 +1,205 @@
+#include "core/BitboardMatcher.h"
+
+static uint64_t fromBelow(const uint64_t *column, int w, int words, int n)
+{
+    uint64_t next = (w + 1 < words) ? column[w + 1] : 0;
+    return (column[w] >> n) | (next << (64 - n));
+}
+
+static uint64_t fromAbove(const uint64_t *column, int w, int n)
+{
+    uint64_t prev = (w > 0) ? column[w - 1] : 0;
+    return (column[w] << n) | (prev >> (64 - n));
+}
+
+bool BitboardMatcher::findMatches(const Board &board, int numColors, BitGrid &mask)
+{
+    if (mask.getWidth() != board.getWidth() || mask.getHeight() != board.getHeight())
+    {
+        mask.resize(board.getWidth(), board.getHeight());
+    }
+    else
+    {
+        mask.clear();
+    }
+
+    buildColorBits(board, numColors);
+
+    for (int c = 0; c < numColors; c++)
+    {
+        markVerticalRuns(colorBits[c], mask);
+        markHorizontalRuns(colorBits[c], mask);
+    }
+
+    return mask.any();
+}
+
+bool BitboardMatcher::hasAnyMove(const Board &board, int numColors)
+{
+    buildColorBits(board, numColors);
+
+    for (int c = 0; c < numColors; c++)
+    {
+        if (hasMoveForColor(colorBits[c]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BitboardMatcher::hasMoveForColor(const BitGrid &bits) const
+{
+    int width = bits.getWidth();
+    int words = bits.getWordsPerColumn();
+
+    for (int j = 0; j < width; j++)
+    {
+        const uint64_t *x = bits.getColumn(j);
+        const uint64_t *left2 = (j >= 2) ? bits.getColumn(j - 2) : nullptr;
+        const uint64_t *left = (j >= 1) ? bits.getColumn(j - 1) : nullptr;
+        const uint64_t *right = (j + 1 < width) ? bits.getColumn(j + 1) : nullptr;
+        const uint64_t *right2 = (j + 2 < width) ? bits.getColumn(j + 2) : nullptr;
+        const uint64_t *right3 = (j + 3 < width) ? bits.getColumn(j + 3) : nullptr;
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t sides1 = (left ? fromBelow(left, w, words, 1) : 0) | (right ? fromBelow(right, w, words, 1) : 0);
+            uint64_t sides2 = (left ? fromBelow(left, w, words, 2) : 0) | (right ? fromBelow(right, w, words, 2) : 0);
+            uint64_t sidesAbove = (left ? fromAbove(left, w, 1) : 0) | (right ? fromAbove(right, w, 1) : 0);
+
+            uint64_t pair = x[w] & fromBelow(x, w, words, 1);
+            if (pair & (fromBelow(x, w, words, 3) | sides2 | fromAbove(x, w, 2) | sidesAbove))
+            {
+                return true;
+            }
+
+            uint64_t split = x[w] & fromBelow(x, w, words, 2);
+            if (split & sides1)
+            {
+                return true;
+            }
+
+            if (!right)
+            {
+                continue;
+            }
+
+            uint64_t rowPair = x[w] & right[w];
+            if (rowPair)
+            {
+                uint64_t targets = 0;
+                if (right2)
+                {
+                    targets |= (right3 ? right3[w] : 0) | fromBelow(right2, w, words, 1) | fromAbove(right2, w, 1);
+                }
+                if (left)
+                {
+                    targets |= (left2 ? left2[w] : 0) | fromBelow(left, w, words, 1) | fromAbove(left, w, 1);
+                }
+                if (rowPair & targets)
+                {
+                    return true;
+                }
+            }
+
+            if (right2 && (x[w] & right2[w] & (fromBelow(right, w, words, 1) | fromAbove(right, w, 1))))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void BitboardMatcher::buildColorBits(const Board &board, int numColors)
+{
+    int width = board.getWidth();
+    int height = board.getHeight();
+
+    if (static_cast<int>(colorBits.size()) < numColors)
+    {
+        colorBits.resize(numColors);
+    }
+
+    for (int c = 0; c < numColors; c++)
+    {
+        if (colorBits[c].getWidth() != width || colorBits[c].getHeight() != height)
+        {
+            colorBits[c].resize(width, height);
+        }
+        else
+        {
+            colorBits[c].clear();
+        }
+    }
+
+    const BitGrid &emptyMask = board.getEmptyMask();
+    for (int j = 0; j < width; j++)
+    {
+        const uint8_t *column = board.getColumn(j);
+        const uint64_t *empty = emptyMask.getColumn(j);
+
+        for (int i = 0; i < height; i++)
+        {
+            uint64_t bit = uint64_t(1) << (i & 63);
+            if (!(empty[i >> 6] & bit) && column[i] < numColors)
+            {
+                colorBits[column[i]].getColumn(j)[i >> 6] |= bit;
+            }
+        }
+    }
+}
+
+void BitboardMatcher::markVerticalRuns(const BitGrid &bits, BitGrid &mask) const
+{
+    int words = bits.getWordsPerColumn();
+
+    for (int j = 0; j < bits.getWidth(); j++)
+    {
+        const uint64_t *column = bits.getColumn(j);
+        uint64_t *out = mask.getColumn(j);
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t x = column[w];
+            uint64_t next = (w + 1 < words) ? column[w + 1] : 0;
+            uint64_t starts = x & ((x >> 1) | (next << 63)) & ((x >> 2) | (next << 62));
+
+            if (starts == 0)
+            {
+                continue;
+            }
+
+            out[w] |= starts | (starts << 1) | (starts << 2);
+            if (w + 1 < words)
+            {
+                out[w + 1] |= (starts >> 63) | (starts >> 62);
+            }
+        }
+    }
+}
+
+void BitboardMatcher::markHorizontalRuns(const BitGrid &bits, BitGrid &mask) const
+{
+    int words = bits.getWordsPerColumn();
+
+    for (int j = 0; j + 2 < bits.getWidth(); j++)
+    {
+        const uint64_t *a = bits.getColumn(j);
+        const uint64_t *b = bits.getColumn(j + 1);
+        const uint64_t *c = bits.getColumn(j + 2);
+
+        for (int w = 0; w < words; w++)
+        {
+            uint64_t starts = a[w] & b[w] & c[w];
+            if (starts != 0)
+            {
+                mask.getColumn(j)[w] |= starts;
+                mask.getColumn(j + 1)[w] |= starts;
+                mask.getColumn(j + 2)[w] |= starts;
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include "core/Board.h"
+#include <algorithm>
+#include <utility>
+
+Board::Board(int width, int height)
+    : width(0), height(0)
+{
+    resize(width, height);
+}
+
+void Board::resize(int newWidth, int newHeight)
+{
+    width = newWidth;
+    height = newHeight;
+    cells.assign(width * height, 0);
+    emptyMask.resize(width, height);
+    rehash();
+}
+
+void Board::setHashing(bool enabled)
+{
+    hashing = enabled;
+    rehash();
+}
+
+void Board::swapCells(int row1, int col1, int row2, int col2)
+{
+    if (hashing)
+    {
+        hash ^= getStateKey(row1, col1) ^ getStateKey(row2, col2);
+    }
+
+    std::swap(cells[col1 * height + row1], cells[col2 * height + row2]);
+
+    bool empty1 = emptyMask.test(row1, col1);
+    bool empty2 = emptyMask.test(row2, col2);
+    if (empty1 != empty2)
+    {
+        if (empty1)
+        {
+            emptyMask.reset(row1, col1);
+            emptyMask.set(row2, col2);
+        }
+        else
+        {
+            emptyMask.set(row1, col1);
+            emptyMask.reset(row2, col2);
+        }
+    }
+
+    if (hashing)
+    {
+        hash ^= getStateKey(row1, col1) ^ getStateKey(row2, col2);
+    }
+}
+
+uint64_t Board::computeHash() const
+{
+    uint64_t result = 0;
+    for (int j = 0; j < width; j++)
+    {
+        result ^= computeColumnHash(j, 0, height);
+    }
+    return result;
+}
+
+uint64_t Board::computeColumnHash(int col, int begin, int end) const
+{
+    uint64_t result = 0;
+    for (int i = begin; i < end; i++)
+    {
+        result ^= getStateKey(i, col);
+    }
+    return result;
+}
+
+uint64_t Board::computeCanonicalHash() const
+{
+    return std::min(computeRelabeledHash(false), computeRelabeledHash(true));
+}
+
+uint64_t Board::computeRelabeledHash(bool mirrored) const
+{
+    int labels[256];
+    std::fill(labels, labels + 256, -1);
+    int nextLabel = 0;
+
+    uint64_t result = 0;
+    for (int j = 0; j < width; j++)
+    {
+        int source = mirrored ? width - 1 - j : j;
+        for (int i = 0; i < height; i++)
+        {
+            int state = emptyState;
+            if (!isEmpty(i, source))
+            {
+                int &label = labels[getColor(i, source)];
+                if (label < 0)
+                {
+                    label = nextLabel++;
+                }
+                state = label;
+            }
+            result ^= getCellKey(j * height + i, state);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,24 @@
+#include "core/BoardEngine.h"
+#include "core/BitboardMatcher.h"
+#include "core/FixedBoardEngine.h"
+
+static const int fixedMaxColors = 10;
+
+std::unique_ptr<BoardEngine> BoardEngine::create(int width, int height, int numColors)
+{
+    if (width == height && numColors <= fixedMaxColors)
+    {
+        switch (width)
+        {
+        case 8:
+            return std::make_unique<FixedBoardEngine<8, 8, fixedMaxColors>>();
+        case 9:
+            return std::make_unique<FixedBoardEngine<9, 9, fixedMaxColors>>();
+        case 10:
+            return std::make_unique<FixedBoardEngine<10, 10, fixedMaxColors>>();
+        default:
+            break;
+        }
+    }
+    return std::make_unique<BitboardMatcher>();
+}
@@ -0,0 +1,110 @@
+#include "core/BoardPool.h"
+#include "core/GameLogic.h"
+#include <algorithm>
+#include <memory>
+
+BoardPool::BoardPool(int workerCount, std::size_t capacity)
+    : capacity(capacity)
+{
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers.emplace_back(&BoardPool::run, this);
+    }
+}
+
+BoardPool::~BoardPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void BoardPool::setConfig(const BoardConfig &newConfig)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (config == newConfig)
+        {
+            return;
+        }
+        config = newConfig;
+        generation++;
+        ready.clear();
+    }
+    wakeup.notify_all();
+}
+
+bool BoardPool::take(const BoardConfig &wanted, std::vector<uint8_t> &colors)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (config != wanted || ready.empty())
+        {
+            return false;
+        }
+        colors.swap(ready.front());
+        ready.pop_front();
+    }
+    wakeup.notify_one();
+    return true;
+}
+
+bool BoardPool::needsBoard() const
+{
+    return config.width >= 3 && config.height >= 3 && config.numColors >= 2 &&
+           ready.size() + inProgress < capacity;
+}
+
+void BoardPool::run()
+{
+    std::unique_ptr<GameLogic> logic;
+    uint64_t logicGeneration = 0;
+    std::vector<uint8_t> colors;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        wakeup.wait(lock, [this]()
+                    { return stopping || needsBoard(); });
+        if (stopping)
+        {
+            return;
+        }
+
+        uint64_t jobGeneration = generation;
+        if (!logic || logicGeneration != jobGeneration)
+        {
+            logic = std::make_unique<GameLogic>(config.width, config.height, config.numColors);
+            logic->setAvailableColors(config.colors);
+            logicGeneration = jobGeneration;
+        }
+        inProgress++;
+        lock.unlock();
+
+        logic->initialize();
+
+        int width = logic->getWidth();
+        int height = logic->getHeight();
+        colors.resize(static_cast<size_t>(width) * height);
+        for (int j = 0; j < width; j++)
+        {
+            const uint8_t *column = logic->getBoard().getColumn(j);
+            std::copy(column, column + height, colors.begin() + j * height);
+        }
+
+        lock.lock();
+        inProgress--;
+        if (generation == jobGeneration)
+        {
+            ready.push_back(std::move(colors));
+            colors.clear();
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include "core/CascadeTrace.h"
+
+void CascadeTrace::reset(int newWidth, int newHeight)
+{
+    width = newWidth;
+    height = newHeight;
+    steps.clear();
+    cleared.clear();
+    falls.clear();
+    spawns.clear();
+}
+
+void CascadeTrace::beginStep()
+{
+    int clearedSize = static_cast<int>(cleared.size());
+    int fallSize = static_cast<int>(falls.size());
+    int spawnSize = static_cast<int>(spawns.size());
+    steps.push_back(CascadeStep{clearedSize, clearedSize, fallSize, fallSize, spawnSize, spawnSize});
+}
+
+void CascadeTrace::endStep()
+{
+    CascadeStep &step = steps.back();
+    step.clearedEnd = static_cast<int>(cleared.size());
+    step.fallEnd = static_cast<int>(falls.size());
+    step.spawnEnd = static_cast<int>(spawns.size());
+}
+
+void CascadeTrace::append(const CascadeTrace &other)
+{
+    cleared.insert(cleared.end(), other.cleared.begin(), other.cleared.end());
+    falls.insert(falls.end(), other.falls.begin(), other.falls.end());
+    spawns.insert(spawns.end(), other.spawns.begin(), other.spawns.end());
+}
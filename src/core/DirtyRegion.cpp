@@ -0,0 +1,107 @@
+#include "core/DirtyRegion.h"
+#include <algorithm>
+
+DirtyRegion::DirtyRegion(int width, int height)
+    : width(0), height(0), full(false)
+{
+    resize(width, height);
+}
+
+void DirtyRegion::resize(int newWidth, int newHeight)
+{
+    width = newWidth;
+    height = newHeight;
+    rowSpans.assign(height, Span{0, 0});
+    columnSpans.assign(width, Span{0, 0});
+    rows.clear();
+    columns.clear();
+    full = false;
+}
+
+void DirtyRegion::markCell(int row, int col)
+{
+    if (full)
+    {
+        return;
+    }
+
+    Span &rowSpan = rowSpans[row];
+    if (rowSpan.begin == rowSpan.end)
+    {
+        rowSpan = Span{col, col + 1};
+        rows.push_back(row);
+    }
+    else
+    {
+        rowSpan.begin = std::min(rowSpan.begin, col);
+        rowSpan.end = std::max(rowSpan.end, col + 1);
+    }
+
+    Span &columnSpan = columnSpans[col];
+    if (columnSpan.begin == columnSpan.end)
+    {
+        columnSpan = Span{row, row + 1};
+        columns.push_back(col);
+    }
+    else
+    {
+        columnSpan.begin = std::min(columnSpan.begin, row);
+        columnSpan.end = std::max(columnSpan.end, row + 1);
+    }
+}
+
+void DirtyRegion::markColumnRange(int col, int begin, int end)
+{
+    if (full || begin >= end)
+    {
+        return;
+    }
+
+    for (int row = begin; row < end; row++)
+    {
+        Span &rowSpan = rowSpans[row];
+        if (rowSpan.begin == rowSpan.end)
+        {
+            rowSpan = Span{col, col + 1};
+            rows.push_back(row);
+        }
+        else
+        {
+            rowSpan.begin = std::min(rowSpan.begin, col);
+            rowSpan.end = std::max(rowSpan.end, col + 1);
+        }
+    }
+
+    Span &columnSpan = columnSpans[col];
+    if (columnSpan.begin == columnSpan.end)
+    {
+        columnSpan = Span{begin, end};
+        columns.push_back(col);
+    }
+    else
+    {
+        columnSpan.begin = std::min(columnSpan.begin, begin);
+        columnSpan.end = std::max(columnSpan.end, end);
+    }
+}
+
+void DirtyRegion::markAll()
+{
+    clear();
+    full = true;
+}
+
+void DirtyRegion::clear()
+{
+    for (int row : rows)
+    {
+        rowSpans[row] = Span{0, 0};
+    }
+    for (int col : columns)
+    {
+        columnSpans[col] = Span{0, 0};
+    }
+    rows.clear();
+    columns.clear();
+    full = false;
+}
@@ -0,0 +1,5 @@
+#include "core/FixedBoardEngine.h"
+
+template class FixedBoardEngine<8, 8, 10>;
+template class FixedBoardEngine<9, 9, 10>;
+template class FixedBoardEngine<10, 10, 10>;
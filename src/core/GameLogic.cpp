@@ -1,35 +1,157 @@
 #include "core/GameLogic.h"
-#include "utils/GameConfig.h"
-#include <random>
-#include <set>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+static MatchKernel activeKernel = MatchKernels::detectBest();
+
+static bool kernelAutoSelected = true;
 
 GameLogic::GameLogic(int width, int height, int numColors)
-    : width(width), height(height), numColors(numColors)
+    : width(width), height(height), numColors(numColors), board(width, height), dirtyRegion(width, height),
+      refillColors(height), seedValue(Rng::generateSeed())
 {
-    grid.resize(height, std::vector<Tile>(width));
-    GameConfig &config = GameConfig::getInstance();
-    availableColorIndices = config.getSelectedColorIndices();
+    rng = std::make_shared<Xoshiro256Rng>(seedValue);
+
+    for (int c = 0; c < numColors; c++)
+    {
+        availableColorIndices.push_back(c);
+    }
+    engine = BoardEngine::create(width, height, numColors);
 }
 
-void GameLogic::initialize()
+bool GameLogic::initialize()
 {
-    if (availableColorIndices.empty())
+    const int maxAttempts = 100;
+
+    bool hasMove = false;
+    for (int attempt = 0; attempt < maxAttempts && !hasMove; attempt++)
     {
-        availableColorIndices = {0, 1, 2, 3, 4, 5};
+        generateMatchFree();
+        hasMove = hasAnyMove();
     }
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, availableColorIndices.size() - 1);
+    dirtyRegion.markAll();
+    return hasMove;
+}
 
-    for (int i = 0; i < height; i++)
+void GameLogic::randomize()
+{
+    int colorCount = static_cast<int>(availableColorIndices.size());
+    board.getEmptyMask().clear();
+
+    if (isParallel())
+    {
+        bool hashing = board.isHashing();
+        std::atomic<uint64_t> newHash(0);
+        drawBandSeeds();
+        threadPool->parallelFor(getBandCount(), [this, colorCount, hashing, &newHash](int band)
+                                {
+                                    Xoshiro256Rng bandRng(bandSeeds[band]);
+                                    uint64_t bandHash = 0;
+                                    for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                    {
+                                        bandRng.drawColors(board.getColumn(j), height, colorCount);
+                                        if (hashing)
+                                        {
+                                            bandHash ^= board.computeColumnHash(j, 0, height);
+                                        }
+                                    }
+                                    newHash.fetch_xor(bandHash, std::memory_order_relaxed);
+                                });
+        if (hashing)
+        {
+            board.toggleHash(board.getHash() ^ newHash.load());
+        }
+    }
+    else
     {
         for (int j = 0; j < width; j++)
         {
-            int randomIdx = dis(gen);
-            grid[i][j].colorIndex = availableColorIndices[randomIdx];
-            grid[i][j].isEmpty = false;
+            rng->drawColors(board.getColumn(j), height, colorCount);
+        }
+        board.rehash();
+    }
+
+    dirtyRegion.markAll();
+}
+
+void GameLogic::generateMatchFree()
+{
+    int colorCount = static_cast<int>(availableColorIndices.size());
+    board.getEmptyMask().clear();
+
+    for (int j = 0; j < width; j++)
+    {
+        uint8_t *column = board.getColumn(j);
+        const uint8_t *left = (j >= 2) ? board.getColumn(j - 1) : nullptr;
+        const uint8_t *left2 = (j >= 2) ? board.getColumn(j - 2) : nullptr;
+
+        for (int i = 0; i < height; i++)
+        {
+            int banned1 = (i >= 2 && column[i - 1] == column[i - 2]) ? column[i - 1] : -1;
+            int banned2 = (left && left[i] == left2[i] && left[i] != banned1) ? left[i] : -1;
+            if (banned1 > banned2)
+            {
+                std::swap(banned1, banned2);
+            }
+
+            int choices = colorCount - (banned1 >= 0) - (banned2 >= 0);
+            if (choices <= 0)
+            {
+                column[i] = static_cast<uint8_t>(rng->nextBelow(colorCount));
+                continue;
+            }
+
+            int color = static_cast<int>(rng->nextBelow(choices));
+            if (banned1 >= 0 && color >= banned1)
+            {
+                color++;
+            }
+            if (banned2 >= 0 && color >= banned2)
+            {
+                color++;
+            }
+            column[i] = static_cast<uint8_t>(color);
+        }
+    }
+
+    board.rehash();
+}
+
+void GameLogic::setColors(const std::vector<uint8_t> &colors)
+{
+    for (int j = 0; j < width; j++)
+    {
+        std::copy(colors.begin() + j * height, colors.begin() + (j + 1) * height, board.getColumn(j));
+    }
+    board.getEmptyMask().clear();
+    board.rehash();
+
+    dirtyRegion.markAll();
+}
+
+void GameLogic::setRng(std::shared_ptr<Rng> newRng)
+{
+    rng = std::move(newRng);
+    rng->seed(seedValue);
+}
+
+void GameLogic::seed(uint64_t seed)
+{
+    seedValue = seed;
+    rng->seed(seed);
+}
+
+void GameLogic::setAvailableColors(const std::vector<int> &colorIndices)
+{
+    if (!colorIndices.empty())
+    {
+        if (colorIndices.size() != availableColorIndices.size())
+        {
+            engine = BoardEngine::create(width, height, static_cast<int>(colorIndices.size()));
         }
+        availableColorIndices = colorIndices;
     }
 }
 
@@ -37,7 +159,7 @@ int GameLogic::getColorIndex(int row, int col) const
 {
     if (row >= 0 && row < height && col >= 0 && col < width)
     {
-        return grid[row][col].colorIndex;
+        return availableColorIndices[board.getColor(row, col)];
     }
     return -1;
 }
@@ -46,148 +168,749 @@ bool GameLogic::isEmpty(int row, int col) const
 {
     if (row >= 0 && row < height && col >= 0 && col < width)
     {
-        return grid[row][col].isEmpty;
+        return board.isEmpty(row, col);
     }
     return true;
 }
 
-std::vector<Match> GameLogic::findMatches()
+bool GameLogic::findMatches(MatchResult &result)
+{
+    result.reset(width, height);
+
+    bool found;
+    if (isParallel())
+    {
+        std::atomic<bool> anyFound(false);
+        BitGrid &mask = result.getMask();
+        TripleScanFn scan = MatchKernels::getTripleScan(activeKernel);
+        bandMatchers.resize(getBandCount());
+        threadPool->parallelFor(getBandCount(), [this, &mask, &anyFound, scan](int band)
+                                {
+                                    if (bandMatchers[band].findMatchesInColumns(board, scan, mask, band * bandColumns,
+                                                                                getBandEnd(band)))
+                                    {
+                                        anyFound.store(true, std::memory_order_relaxed);
+                                    }
+                                });
+
+        bool bandsFound = anyFound.load(std::memory_order_relaxed);
+        result.setMaskOnly(bandsFound);
+        if (!bandsFound)
+        {
+            dirtyRegion.clear();
+            return false;
+        }
+        return true;
+    }
+    else if (usesBoardEngine())
+    {
+        found = engine->findMatches(board, static_cast<int>(availableColorIndices.size()), result.getMask());
+    }
+    else
+    {
+        found = scanMatcher.findMatches(board, MatchKernels::getTripleScan(activeKernel), result.getMask());
+    }
+
+    if (!found)
+    {
+        dirtyRegion.clear();
+        return false;
+    }
+
+    collectRuns(result);
+    return true;
+}
+
+bool GameLogic::findMatchesInDirtyRegion(MatchResult &result)
+{
+    if (dirtyRegion.isFull())
+    {
+        return findMatches(result);
+    }
+
+    result.reset(width, height);
+
+    for (int row : dirtyRegion.getRows())
+    {
+        markRowRuns(row, dirtyRegion.getRowBegin(row), dirtyRegion.getRowEnd(row), result);
+    }
+    for (int col : dirtyRegion.getColumns())
+    {
+        markColumnRuns(col, dirtyRegion.getColumnBegin(col), dirtyRegion.getColumnEnd(col), result);
+    }
+
+    if (result.empty())
+    {
+        dirtyRegion.clear();
+        return false;
+    }
+    return true;
+}
+
+bool GameLogic::findMatchesReference(MatchResult &result)
+{
+    result.reset(width, height);
+    findHorizontalMatches(result);
+    findVerticalMatches(result);
+    return !result.empty();
+}
+
+bool GameLogic::isSameTile(int row1, int col1, int row2, int col2) const
+{
+    return !board.isEmpty(row1, col1) && !board.isEmpty(row2, col2) &&
+           board.getColor(row1, col1) == board.getColor(row2, col2);
+}
+
+void GameLogic::collectRuns(MatchResult &result) const
+{
+    const BitGrid &mask = result.getMask();
+
+    for (int j = 0; j < width; j++)
+    {
+        if (!mask.anyInColumn(j))
+        {
+            continue;
+        }
+
+        for (int i = 0; i < height; i++)
+        {
+            if (!mask.test(i, j) || (j > 0 && mask.test(i, j - 1) && isSameTile(i, j - 1, i, j)))
+            {
+                continue;
+            }
+
+            int k = j + 1;
+            while (k < width && mask.test(i, k) && isSameTile(i, j, i, k))
+            {
+                k++;
+            }
+            if (k - j >= 3)
+            {
+                result.addRun(i, j, k - j, true);
+            }
+        }
+
+        for (int i = 0; i < height;)
+        {
+            if (!mask.test(i, j))
+            {
+                i++;
+                continue;
+            }
+
+            int k = i + 1;
+            while (k < height && mask.test(k, j) && isSameTile(i, j, k, j))
+            {
+                k++;
+            }
+            if (k - i >= 3)
+            {
+                result.addRun(i, j, k - i, false);
+            }
+            i = k;
+        }
+    }
+}
+
+void GameLogic::markRowRuns(int row, int begin, int end, MatchResult &result) const
+{
+    int j = std::max(0, begin - 2);
+    int last = std::min(width, end + 2);
+
+    while (j > 0 && isSameTile(row, j - 1, row, j))
+    {
+        j--;
+    }
+
+    while (j < last)
+    {
+        int k = j + 1;
+        while (k < width && isSameTile(row, j, row, k))
+        {
+            k++;
+        }
+
+        if (k - j >= 3)
+        {
+            result.addRun(row, j, k - j, true);
+        }
+        j = k;
+    }
+}
+
+void GameLogic::markColumnRuns(int col, int begin, int end, MatchResult &result) const
 {
-    std::vector<Match> matches;
-    findHorizontalMatches(matches);
-    findVerticalMatches(matches);
-    return matches;
+    int i = std::max(0, begin - 2);
+    int last = std::min(height, end + 2);
+
+    while (i > 0 && isSameTile(i - 1, col, i, col))
+    {
+        i--;
+    }
+
+    while (i < last)
+    {
+        int k = i + 1;
+        while (k < height && isSameTile(i, col, k, col))
+        {
+            k++;
+        }
+
+        if (k - i >= 3)
+        {
+            result.addRun(i, col, k - i, false);
+        }
+        i = k;
+    }
 }
 
-void GameLogic::findHorizontalMatches(std::vector<Match> &matches)
+void GameLogic::findHorizontalMatches(MatchResult &result)
 {
     for (int i = 0; i < height; i++)
     {
+        Board::RowView row = board.getRow(i);
+
         for (int j = 0; j < width; j++)
         {
-            if (grid[i][j].isEmpty) continue;
-            
-            int colorIndex = grid[i][j].colorIndex;
+            if (board.isEmpty(i, j)) continue;
+
+            uint8_t color = row[j];
             int count = 1;
-            
-            while (j + count < width && 
-                   !grid[i][j + count].isEmpty && 
-                   grid[i][j + count].colorIndex == colorIndex)
+
+            while (j + count < width &&
+                   !board.isEmpty(i, j + count) &&
+                   row[j + count] == color)
             {
                 count++;
             }
-            
+
             if (count >= 3)
             {
-                Match match;
-                for (int k = 0; k < count; k++)
-                {
-                    match.positions.push_back(sf::Vector2i(j + k, i));
-                }
-                matches.push_back(match);
+                result.addRun(i, j, count, true);
                 j += count - 1;
             }
         }
     }
 }
 
-void GameLogic::findVerticalMatches(std::vector<Match> &matches)
+void GameLogic::findVerticalMatches(MatchResult &result)
 {
     for (int j = 0; j < width; j++)
     {
+        const uint8_t *column = board.getColumn(j);
+
         for (int i = 0; i < height; i++)
         {
-            if (grid[i][j].isEmpty) continue;
-            
-            int colorIndex = grid[i][j].colorIndex;
+            if (board.isEmpty(i, j)) continue;
+
+            uint8_t color = column[i];
             int count = 1;
-            
-            while (i + count < height && 
-                   !grid[i + count][j].isEmpty && 
-                   grid[i + count][j].colorIndex == colorIndex)
+
+            while (i + count < height &&
+                   !board.isEmpty(i + count, j) &&
+                   column[i + count] == color)
             {
                 count++;
             }
-            
+
             if (count >= 3)
             {
-                Match match;
-                for (int k = 0; k < count; k++)
-                {
-                    match.positions.push_back(sf::Vector2i(j, i + k));
-                }
-                matches.push_back(match);
+                result.addRun(i, j, count, false);
                 i += count - 1;
             }
         }
     }
 }
 
-void GameLogic::clearMatches(const std::vector<Match> &matches)
+void GameLogic::clearMatches(const MatchResult &result)
 {
-    std::set<std::pair<int, int>> toRemove;
-    
-    for (const auto &match : matches)
+    const BitGrid &mask = result.getMask();
+
+    if (isParallel())
     {
-        for (const auto &pos : match.positions)
+        std::atomic<uint64_t> hashChange(0);
+        threadPool->parallelFor(getBandCount(), [this, &mask, &hashChange](int band)
+                                {
+                                    uint64_t bandChange = 0;
+                                    for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                    {
+                                        bandChange ^= clearColumn(j, mask);
+                                    }
+                                    hashChange.fetch_xor(bandChange, std::memory_order_relaxed);
+                                });
+        board.toggleHash(hashChange.load());
+    }
+    else if (!board.isHashing())
+    {
+        board.getEmptyMask() |= mask;
+    }
+    else
+    {
+        uint64_t hashChange = 0;
+        for (int j = 0; j < width; j++)
         {
-            toRemove.insert({pos.y, pos.x});
+            if (mask.anyInColumn(j))
+            {
+                hashChange ^= clearColumn(j, mask);
+            }
         }
+        board.toggleHash(hashChange);
     }
-    
-    for (const auto &pos : toRemove)
+    dirtyRegion.clear();
+}
+
+uint64_t GameLogic::clearColumn(int col, const BitGrid &mask)
+{
+    uint64_t *out = board.getEmptyMask().getColumn(col);
+    const uint64_t *cleared = mask.getColumn(col);
+    const uint8_t *column = board.getColumn(col);
+    int words = mask.getWordsPerColumn();
+    bool hashing = board.isHashing();
+
+    uint64_t hashChange = 0;
+    for (int w = 0; w < words; w++)
     {
-        grid[pos.first][pos.second].isEmpty = true;
+        uint64_t bits = hashing ? cleared[w] & ~out[w] : 0;
+        while (bits != 0)
+        {
+            int bit = BitGrid::highestBit(bits);
+            bits &= ~(1ull << bit);
+
+            int row = w * 64 + bit;
+            int cell = col * height + row;
+            hashChange ^= Board::getCellKey(cell, column[row]) ^ Board::getCellKey(cell, Board::emptyState);
+        }
+        out[w] |= cleared[w];
     }
+    return hashChange;
 }
 
-std::vector<sf::Vector2i> GameLogic::applyGravity()
+std::vector<GridPos> GameLogic::applyGravity()
 {
-    std::vector<sf::Vector2i> affectedColumns;
-    
+    std::vector<GridPos> affectedColumns;
+
+    if (isParallel())
+    {
+        std::atomic<uint64_t> hashChange(0);
+        changedColumns.assign(width, 0);
+        threadPool->parallelFor(getBandCount(), [this, &hashChange](int band)
+                                {
+                                    uint64_t bandChange = 0;
+                                    for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                    {
+                                        changedColumns[j] = collapseColumn(j, bandChange, nullptr, nullptr);
+                                    }
+                                    hashChange.fetch_xor(bandChange, std::memory_order_relaxed);
+                                });
+        board.toggleHash(hashChange.load());
+        dirtyRegion.markAll();
+
+        for (int j = 0; j < width; j++)
+        {
+            if (changedColumns[j])
+            {
+                affectedColumns.push_back(GridPos(j, 0));
+            }
+        }
+        return affectedColumns;
+    }
+
+    uint64_t hashChange = 0;
+    for (int j = 0; j < width; j++)
+    {
+        if (collapseColumn(j, hashChange, nullptr, &dirtyRegion))
+        {
+            affectedColumns.push_back(GridPos(j, 0));
+        }
+    }
+    board.toggleHash(hashChange);
+
+    return affectedColumns;
+}
+
+std::vector<GridPos> GameLogic::applyGravityReference()
+{
+    std::vector<GridPos> affectedColumns;
+
     for (int j = 0; j < width; j++)
     {
         bool columnChanged = false;
         int writePos = height - 1;
-        
+
         for (int i = height - 1; i >= 0; i--)
         {
-            if (!grid[i][j].isEmpty)
+            if (board.isEmpty(i, j))
             {
-                if (i != writePos)
-                {
-                    grid[writePos][j] = grid[i][j];
-                    grid[i][j].isEmpty = true;
-                    columnChanged = true;
-                }
-                writePos--;
+                continue;
             }
+            if (i != writePos)
+            {
+                board.setColor(writePos, j, board.getColor(i, j));
+                board.setEmpty(i, j);
+                dirtyRegion.markCell(writePos, j);
+                columnChanged = true;
+            }
+            writePos--;
         }
-        
+
         if (columnChanged)
         {
-            affectedColumns.push_back(sf::Vector2i(j, 0));
+            affectedColumns.push_back(GridPos(j, 0));
         }
     }
-    
+
     return affectedColumns;
 }
 
-void GameLogic::fillEmptySpaces()
+void GameLogic::fillEmptySpacesReference()
 {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, availableColorIndices.size() - 1);
-    
+    int colorCount = static_cast<int>(availableColorIndices.size());
+
     for (int j = 0; j < width; j++)
     {
+        int count = 0;
         for (int i = 0; i < height; i++)
         {
-            if (grid[i][j].isEmpty)
+            if (board.isEmpty(i, j))
             {
-                int randomIdx = dis(gen);
-                grid[i][j].colorIndex = availableColorIndices[randomIdx];
-                grid[i][j].isEmpty = false;
+                count++;
+            }
+        }
+
+        rng->drawColors(refillColors.data(), count, colorCount);
+
+        int next = 0;
+        for (int i = 0; i < height && next < count; i++)
+        {
+            if (board.isEmpty(i, j))
+            {
+                board.setColor(i, j, refillColors[next++]);
+                dirtyRegion.markCell(i, j);
+            }
+        }
+    }
+}
+
+void GameLogic::fillEmptySpaces()
+{
+    if (isParallel())
+    {
+        // Each band draws from its own generator seeded from the main one,
+        // so the result is the same for any number of threads.
+        std::atomic<uint64_t> hashChange(0);
+        drawBandSeeds();
+        threadPool->parallelFor(getBandCount(), [this, &hashChange](int band)
+                                {
+                                    Xoshiro256Rng bandRng(bandSeeds[band]);
+                                    std::vector<uint8_t> colors(height);
+                                    uint64_t bandChange = 0;
+                                    for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                    {
+                                        refillColumn(j, bandRng, colors, bandChange, nullptr, nullptr);
+                                    }
+                                    hashChange.fetch_xor(bandChange, std::memory_order_relaxed);
+                                });
+        board.toggleHash(hashChange.load());
+        dirtyRegion.markAll();
+        return;
+    }
+
+    uint64_t hashChange = 0;
+    for (int j = 0; j < width; j++)
+    {
+        refillColumn(j, *rng, refillColors, hashChange, nullptr, &dirtyRegion);
+    }
+    board.toggleHash(hashChange);
+}
+
+bool GameLogic::resolveStep(CascadeTrace &trace)
+{
+    if (trace.getWidth() != width || trace.getHeight() != height)
+    {
+        trace.reset(width, height);
+    }
+    return resolveStep(&trace);
+}
+
+bool GameLogic::resolveStep(CascadeTrace *trace)
+{
+    if (!findMatchesInDirtyRegion(stepResult))
+    {
+        return false;
+    }
+
+    if (trace)
+    {
+        trace->beginStep();
+    }
+
+    if (isParallel())
+    {
+        resolveStepInBands(trace);
+    }
+    else
+    {
+        if (trace)
+        {
+            for (int j = 0; j < width; j++)
+            {
+                traceCleared(j, stepResult.getMask(), *trace);
+            }
+        }
+
+        clearMatches(stepResult);
+
+        uint64_t hashChange = 0;
+        for (int j = 0; j < width; j++)
+        {
+            collapseColumn(j, hashChange, trace, &dirtyRegion);
+        }
+        for (int j = 0; j < width; j++)
+        {
+            refillColumn(j, *rng, refillColors, hashChange, trace, &dirtyRegion);
+        }
+        board.toggleHash(hashChange);
+    }
+
+    if (trace)
+    {
+        trace->endStep();
+    }
+    return true;
+}
+
+void GameLogic::resolveStepInBands(CascadeTrace *trace)
+{
+    const BitGrid &mask = stepResult.getMask();
+    std::atomic<uint64_t> hashChange(0);
+    bandTraces.resize(trace ? getBandCount() : 0);
+    drawBandSeeds();
+
+    threadPool->parallelFor(getBandCount(), [this, &mask, &hashChange, trace](int band)
+                            {
+                                CascadeTrace *bandTrace = trace ? &bandTraces[band] : nullptr;
+                                if (bandTrace)
+                                {
+                                    bandTrace->reset(width, height);
+                                }
+                                Xoshiro256Rng bandRng(bandSeeds[band]);
+                                std::vector<uint8_t> colors(height);
+                                uint64_t bandChange = 0;
+
+                                for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                {
+                                    if (bandTrace)
+                                    {
+                                        traceCleared(j, mask, *bandTrace);
+                                    }
+                                    bandChange ^= clearColumn(j, mask);
+                                }
+                                for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                {
+                                    collapseColumn(j, bandChange, bandTrace, nullptr);
+                                }
+                                for (int j = band * bandColumns; j < getBandEnd(band); j++)
+                                {
+                                    refillColumn(j, bandRng, colors, bandChange, bandTrace, nullptr);
+                                }
+                                hashChange.fetch_xor(bandChange, std::memory_order_relaxed);
+                            });
+
+    board.toggleHash(hashChange.load());
+    for (const CascadeTrace &bandTrace : bandTraces)
+    {
+        trace->append(bandTrace);
+    }
+    dirtyRegion.markAll();
+}
+
+void GameLogic::traceCleared(int col, const BitGrid &mask, CascadeTrace &trace) const
+{
+    if (!mask.anyInColumn(col))
+    {
+        return;
+    }
+    for (int i = 0; i < height; i++)
+    {
+        if (mask.test(i, col))
+        {
+            trace.addCleared(col * height + i);
+        }
+    }
+}
+
+int GameLogic::resolveCascade(CascadeTrace &trace, int maxSteps)
+{
+    trace.reset(width, height);
+
+    int steps = 0;
+    while (steps < maxSteps && resolveStep(&trace))
+    {
+        steps++;
+    }
+    return steps;
+}
+
+int GameLogic::resolveCascade(int maxSteps)
+{
+    int steps = 0;
+    while (steps < maxSteps && resolveStep(nullptr))
+    {
+        steps++;
+    }
+    return steps;
+}
+
+bool GameLogic::collapseColumn(int col, uint64_t &hashChange, CascadeTrace *trace, DirtyRegion *dirty)
+{
+    BitGrid &empty = board.getEmptyMask();
+    if (!empty.anyInColumn(col))
+    {
+        return false;
+    }
+
+    bool hashing = board.isHashing();
+    uint8_t *column = board.getColumn(col);
+    bool columnChanged = false;
+    int writeEnd = height;
+    int end = height;
+
+    while (true)
+    {
+        int runEnd = empty.lastClearInColumn(col, end) + 1;
+        if (runEnd == 0)
+        {
+            break;
+        }
+        int runBegin = empty.lastSetInColumn(col, runEnd) + 1;
+        int length = runEnd - runBegin;
+        int dest = writeEnd - length;
+
+        if (dest != runBegin)
+        {
+            std::memmove(column + dest, column + runBegin, length);
+            columnChanged = true;
+
+            if (hashing)
+            {
+                for (int k = 0; k < length; k++)
+                {
+                    hashChange ^= Board::getCellKey(col * height + runBegin + k, column[dest + k]) ^
+                                  Board::getCellKey(col * height + dest + k, column[dest + k]);
+                }
+            }
+
+            if (trace)
+            {
+                for (int k = length - 1; k >= 0; k--)
+                {
+                    trace->addFall(col * height + dest + k, dest - runBegin);
+                }
+            }
+            if (dirty)
+            {
+                dirty->markColumnRange(col, dest, dest + length);
+            }
+        }
+
+        writeEnd = dest;
+        end = runBegin;
+    }
+
+    if (hashing)
+    {
+        hashChange ^= hashEmptyFlips(col, writeEnd);
+    }
+    empty.setColumnPrefix(col, writeEnd);
+    return columnChanged;
+}
+
+uint64_t GameLogic::hashEmptyFlips(int col, int prefix) const
+{
+    const BitGrid &empty = board.getEmptyMask();
+    const uint64_t *words = empty.getColumn(col);
+
+    uint64_t hashChange = 0;
+    for (int w = 0; w < empty.getWordsPerColumn(); w++)
+    {
+        int prefixBits = std::min(64, std::max(0, prefix - w * 64));
+        uint64_t prefixWord = prefixBits == 64 ? ~0ull : (1ull << prefixBits) - 1;
+        uint64_t flips = words[w] ^ prefixWord;
+        while (flips != 0)
+        {
+            int bit = BitGrid::highestBit(flips);
+            flips &= ~(1ull << bit);
+            hashChange ^= Board::getCellKey(col * height + w * 64 + bit, Board::emptyState);
+        }
+    }
+    return hashChange;
+}
+
+void GameLogic::refillColumn(int col, Rng &colorRng, std::vector<uint8_t> &colors, uint64_t &hashChange,
+                             CascadeTrace *trace, DirtyRegion *dirty)
+{
+    BitGrid &empty = board.getEmptyMask();
+    int count = empty.countInColumn(col);
+    if (count == 0)
+    {
+        return;
+    }
+
+    int colorCount = static_cast<int>(availableColorIndices.size());
+    uint8_t *column = board.getColumn(col);
+
+    if (empty.lastSetInColumn(col, height) == count - 1)
+    {
+        colorRng.drawColors(column, count, colorCount);
+        empty.setColumnPrefix(col, 0);
+
+        if (board.isHashing())
+        {
+            for (int i = 0; i < count; i++)
+            {
+                int cell = col * height + i;
+                hashChange ^= Board::getCellKey(cell, Board::emptyState) ^ Board::getCellKey(cell, column[i]);
+            }
+        }
+
+        if (trace)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                trace->addSpawn(col * height + i, column[i]);
+            }
+        }
+        if (dirty)
+        {
+            dirty->markColumnRange(col, 0, count);
+        }
+        return;
+    }
+
+    colorRng.drawColors(colors.data(), count, colorCount);
+
+    int next = 0;
+    for (int i = 0; i < height && next < count; i++)
+    {
+        if (board.isEmpty(i, col))
+        {
+            uint8_t color = colors[next++];
+            if (board.isHashing())
+            {
+                int cell = col * height + i;
+                hashChange ^= Board::getCellKey(cell, Board::emptyState) ^ Board::getCellKey(cell, color);
+            }
+            column[i] = color;
+            empty.reset(i, col);
+
+            if (dirty)
+            {
+                dirty->markCell(i, col);
+            }
+
+            if (trace)
+            {
+                trace->addSpawn(col * height + i, color);
             }
         }
     }
@@ -198,6 +921,216 @@ void GameLogic::swapTiles(int row1, int col1, int row2, int col2)
     if (row1 >= 0 && row1 < height && col1 >= 0 && col1 < width &&
         row2 >= 0 && row2 < height && col2 >= 0 && col2 < width)
     {
-        std::swap(grid[row1][col1], grid[row2][col2]);
+        board.swapCells(row1, col1, row2, col2);
+        dirtyRegion.markCell(row1, col1);
+        dirtyRegion.markCell(row2, col2);
+    }
+}
+
+bool GameLogic::hasAnyMove()
+{
+    if (isParallel())
+    {
+        return hasAnyMoveScan();
+    }
+    return engine->hasAnyMove(board, static_cast<int>(availableColorIndices.size()));
+}
+
+int GameLogic::scoreSwap(int row1, int col1, int row2, int col2) const
+{
+    if (board.isEmpty(row1, col1) || board.isEmpty(row2, col2) ||
+        board.getColor(row1, col1) == board.getColor(row2, col2))
+    {
+        return 0;
+    }
+
+    Move move{row1, col1, row2, col2};
+    return runScoreAfterSwap(row1, col1, move) + runScoreAfterSwap(row2, col2, move);
+}
+
+void GameLogic::findValidMoves(std::vector<Move> &moves) const
+{
+    moves.clear();
+
+    for (int j = 0; j < width; j++)
+    {
+        for (int i = 0; i < height; i++)
+        {
+            if (j + 1 < width && scoreSwap(i, j, i, j + 1) > 0)
+            {
+                moves.push_back(Move{i, j, i, j + 1});
+            }
+            if (i + 1 < height && scoreSwap(i, j, i + 1, j) > 0)
+            {
+                moves.push_back(Move{i, j, i + 1, j});
+            }
+        }
+    }
+}
+
+int GameLogic::colorAfterSwap(int row, int col, const Move &move) const
+{
+    if (row == move.row1 && col == move.col1)
+    {
+        return board.getColor(move.row2, move.col2);
+    }
+    if (row == move.row2 && col == move.col2)
+    {
+        return board.getColor(move.row1, move.col1);
+    }
+    return board.isEmpty(row, col) ? -1 : board.getColor(row, col);
+}
+
+int GameLogic::runScoreAfterSwap(int row, int col, const Move &move) const
+{
+    int color = colorAfterSwap(row, col, move);
+
+    int left = col;
+    while (left > 0 && colorAfterSwap(row, left - 1, move) == color) left--;
+    int right = col;
+    while (right + 1 < width && colorAfterSwap(row, right + 1, move) == color) right++;
+    int up = row;
+    while (up > 0 && colorAfterSwap(up - 1, col, move) == color) up--;
+    int down = row;
+    while (down + 1 < height && colorAfterSwap(down + 1, col, move) == color) down++;
+
+    int horizontal = right - left + 1;
+    int vertical = down - up + 1;
+    int score = 0;
+    if (horizontal >= 3) score += horizontal;
+    if (vertical >= 3) score += vertical;
+    return score;
+}
+
+bool GameLogic::reshuffle()
+{
+    shuffleColors.clear();
+    for (int j = 0; j < width; j++)
+    {
+        for (int i = 0; i < height; i++)
+        {
+            if (!board.isEmpty(i, j))
+            {
+                shuffleColors.push_back(board.getColor(i, j));
+            }
+        }
+    }
+
+    const int maxAttempts = 100;
+
+    for (int attempt = 0; attempt < maxAttempts; attempt++)
+    {
+        for (int k = static_cast<int>(shuffleColors.size()) - 1; k > 0; k--)
+        {
+            std::swap(shuffleColors[k], shuffleColors[rng->nextBelow(k + 1)]);
+        }
+
+        int next = 0;
+        for (int j = 0; j < width; j++)
+        {
+            for (int i = 0; i < height; i++)
+            {
+                if (board.isEmpty(i, j))
+                {
+                    continue;
+                }
+
+                int pick = next;
+                while (pick < static_cast<int>(shuffleColors.size()) && completesRun(i, j, shuffleColors[pick]))
+                {
+                    pick++;
+                }
+                if (pick == static_cast<int>(shuffleColors.size()))
+                {
+                    pick = next;
+                }
+
+                std::swap(shuffleColors[next], shuffleColors[pick]);
+                board.setColor(i, j, shuffleColors[next]);
+                next++;
+            }
+        }
+
+        dirtyRegion.markAll();
+        if (!findMatches(reshuffleResult) && hasAnyMove())
+        {
+            return true;
+        }
+    }
+
+    dirtyRegion.markAll();
+    return false;
+}
+
+bool GameLogic::completesRun(int row, int col, uint8_t color) const
+{
+    if (row >= 2 && !board.isEmpty(row - 1, col) && !board.isEmpty(row - 2, col) &&
+        board.getColor(row - 1, col) == color && board.getColor(row - 2, col) == color)
+    {
+        return true;
+    }
+    return col >= 2 && !board.isEmpty(row, col - 1) && !board.isEmpty(row, col - 2) &&
+           board.getColor(row, col - 1) == color && board.getColor(row, col - 2) == color;
+}
+
+void GameLogic::setMatchKernel(MatchKernel kernel)
+{
+    kernelAutoSelected = kernel == MatchKernel::Auto || !MatchKernels::isSupported(kernel);
+    if (kernelAutoSelected)
+    {
+        kernel = MatchKernels::detectBest();
+    }
+    activeKernel = kernel;
+}
+
+MatchKernel GameLogic::getMatchKernel()
+{
+    return activeKernel;
+}
+
+bool GameLogic::isParallel() const
+{
+    return threadPool && static_cast<long long>(width) * height >= parallelMinCells;
+}
+
+bool GameLogic::usesBoardEngine() const
+{
+    return activeKernel == MatchKernel::Bitboard || (kernelAutoSelected && engine->isSpecialized());
+}
+
+std::string GameLogic::getMatchEngineName() const
+{
+    if (isParallel())
+    {
+        return std::string("bands/") + MatchKernels::getName(activeKernel);
+    }
+    if (usesBoardEngine())
+    {
+        return engine->isSpecialized() ? "fixed" : "bitboard";
+    }
+    return MatchKernels::getName(activeKernel);
+}
+
+void GameLogic::drawBandSeeds()
+{
+    bandSeeds.resize(getBandCount());
+    for (uint64_t &seed : bandSeeds)
+    {
+        seed = rng->next();
+    }
+}
+
+bool GameLogic::hasAnyMoveScan() const
+{
+    for (int j = 0; j < width; j++)
+    {
+        for (int i = 0; i < height; i++)
+        {
+            if ((j + 1 < width && scoreSwap(i, j, i, j + 1) > 0) || (i + 1 < height && scoreSwap(i, j, i + 1, j) > 0))
+            {
+                return true;
+            }
+        }
     }
+    return false;
 }
@@ -0,0 +1,166 @@
+#include "core/GameSimulation.h"
+#include <chrono>
+#include <cstdlib>
+
+// The producer notifies without taking wakeMutex so it never blocks; a
+// wakeup lost to that race is covered by the wait timeout.
+static const std::chrono::milliseconds wakeupInterval(50);
+
+GameSimulation::GameSimulation()
+    : thread(&GameSimulation::run, this)
+{
+}
+
+GameSimulation::~GameSimulation()
+{
+    stopping.store(true, std::memory_order_release);
+    wakeup.notify_one();
+    thread.join();
+}
+
+bool GameSimulation::prepare(const BoardConfig &config)
+{
+    SimCommand command;
+    command.type = SimCommandType::Prepare;
+    command.config = config;
+    return submit(command) != 0;
+}
+
+uint64_t GameSimulation::start(const BoardConfig &config)
+{
+    SimCommand command;
+    command.type = SimCommandType::Start;
+    command.config = config;
+    return submit(command);
+}
+
+uint64_t GameSimulation::requestSwap(const Move &move)
+{
+    SimCommand command;
+    command.type = SimCommandType::Swap;
+    command.move = move;
+    return submit(command);
+}
+
+uint64_t GameSimulation::submit(SimCommand &command)
+{
+    command.sequence = nextSequence;
+    if (!commands.push(command))
+    {
+        return 0;
+    }
+    wakeup.notify_one();
+    return nextSequence++;
+}
+
+void GameSimulation::run()
+{
+    SimCommand command;
+    while (!stopping.load(std::memory_order_acquire))
+    {
+        if (commands.pop(command))
+        {
+            execute(command);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeup.wait_for(lock, wakeupInterval, [this]()
+                        { return stopping.load(std::memory_order_acquire) || !commands.empty(); });
+    }
+}
+
+void GameSimulation::execute(const SimCommand &command)
+{
+    if (command.type == SimCommandType::Prepare)
+    {
+        boardPool.setConfig(command.config);
+        return;
+    }
+
+    BoardSnapshot &snapshot = snapshots.back();
+    snapshot.sequence = command.sequence;
+    snapshot.swapValid = false;
+    snapshot.reshuffled = false;
+
+    if (command.type == SimCommandType::Start)
+    {
+        const BoardConfig &config = command.config;
+        boardPool.setConfig(config);
+
+        logic = std::make_unique<GameLogic>(config.width, config.height, config.numColors);
+        logic->setAvailableColors(config.colors);
+        if (boardPool.take(config, pooledColors))
+        {
+            logic->setColors(pooledColors);
+        }
+        else
+        {
+            logic->initialize();
+        }
+    }
+    else if (logic)
+    {
+        const Move &move = command.move;
+        bool inside = move.row1 >= 0 && move.row1 < logic->getHeight() && move.col1 >= 0 &&
+                      move.col1 < logic->getWidth() && move.row2 >= 0 && move.row2 < logic->getHeight() &&
+                      move.col2 >= 0 && move.col2 < logic->getWidth();
+        bool adjacent = std::abs(move.row1 - move.row2) + std::abs(move.col1 - move.col2) == 1;
+
+        if (inside && adjacent)
+        {
+            logic->swapTiles(move.row1, move.col1, move.row2, move.col2);
+            snapshot.swapValid = logic->findMatchesInDirtyRegion(swapResult);
+            if (!snapshot.swapValid)
+            {
+                logic->swapTiles(move.row1, move.col1, move.row2, move.col2);
+            }
+        }
+    }
+
+    if (!logic)
+    {
+        snapshot.width = 0;
+        snapshot.height = 0;
+        snapshot.trace.reset(0, 0);
+        snapshots.publish();
+        return;
+    }
+
+    snapshot.width = logic->getWidth();
+    snapshot.height = logic->getHeight();
+    snapshot.availableColors = logic->getAvailableColors();
+    copyColors(snapshot.initialColors);
+
+    if (command.type == SimCommandType::Start || snapshot.swapValid)
+    {
+        logic->resolveCascade(snapshot.trace);
+        if (!logic->hasAnyMove())
+        {
+            logic->reshuffle();
+            snapshot.reshuffled = true;
+        }
+    }
+    else
+    {
+        snapshot.trace.reset(snapshot.width, snapshot.height);
+    }
+
+    copyColors(snapshot.finalColors);
+    snapshots.publish();
+}
+
+void GameSimulation::copyColors(std::vector<int> &colors) const
+{
+    int width = logic->getWidth();
+    int height = logic->getHeight();
+
+    colors.resize(static_cast<size_t>(width) * height);
+    for (int i = 0; i < height; i++)
+    {
+        for (int j = 0; j < width; j++)
+        {
+            colors[i * width + j] = logic->getColorIndex(i, j);
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include "core/MatchKernels.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MATCH3_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MATCH3_TARGET(features) __attribute__((target(features)))
+#else
+#define MATCH3_TARGET(features)
+#endif
+
+static void scanTriplesTail(const uint8_t *a, const uint8_t *b, const uint8_t *c, int begin, int count, uint64_t *out)
+{
+    for (int i = begin; i < count; i++)
+    {
+        if (a[i] == b[i] && a[i] == c[i])
+        {
+            out[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+}
+
+static void scanTriplesScalar(const uint8_t *a, const uint8_t *b, const uint8_t *c, int count, uint64_t *out)
+{
+    std::memset(out, 0, ((count + 63) / 64) * sizeof(uint64_t));
+    scanTriplesTail(a, b, c, 0, count, out);
+}
+
+#ifdef MATCH3_X86
+MATCH3_TARGET("sse2")
+static void scanTriplesSSE2(const uint8_t *a, const uint8_t *b, const uint8_t *c, int count, uint64_t *out)
+{
+    std::memset(out, 0, ((count + 63) / 64) * sizeof(uint64_t));
+
+    int i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c + i));
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(va, vb), _mm_cmpeq_epi8(va, vc));
+        uint64_t bits = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+        out[i >> 6] |= bits << (i & 63);
+    }
+
+    scanTriplesTail(a, b, c, i, count, out);
+}
+
+MATCH3_TARGET("avx2")
+static void scanTriplesAVX2(const uint8_t *a, const uint8_t *b, const uint8_t *c, int count, uint64_t *out)
+{
+    std::memset(out, 0, ((count + 63) / 64) * sizeof(uint64_t));
+
+    int i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(c + i));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(va, vb), _mm256_cmpeq_epi8(va, vc));
+        uint64_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+        out[i >> 6] |= bits << (i & 63);
+    }
+
+    scanTriplesTail(a, b, c, i, count, out);
+}
+
+MATCH3_TARGET("avx512f,avx512bw")
+static void scanTriplesAVX512(const uint8_t *a, const uint8_t *b, const uint8_t *c, int count, uint64_t *out)
+{
+    std::memset(out, 0, ((count + 63) / 64) * sizeof(uint64_t));
+
+    int i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i vc = _mm512_loadu_si512(c + i);
+        __mmask64 eq = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(va, vb), va, vc);
+        out[i >> 6] = static_cast<uint64_t>(eq);
+    }
+
+    scanTriplesTail(a, b, c, i, count, out);
+}
+
+struct CpuFeatures
+{
+    bool sse2 = false;
+    bool avx2 = false;
+    bool avx512 = false;
+};
+
+static CpuFeatures queryCpuFeatures()
+{
+    CpuFeatures features;
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    features.sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+
+    if (maxLeaf >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        features.avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+        features.avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0 && (xcr0 & 0xE6) == 0xE6;
+    }
+#else
+    __builtin_cpu_init();
+    features.sse2 = __builtin_cpu_supports("sse2");
+    features.avx2 = __builtin_cpu_supports("avx2");
+    features.avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+    return features;
+}
+
+static const CpuFeatures &getCpuFeatures()
+{
+    static const CpuFeatures features = queryCpuFeatures();
+    return features;
+}
+#endif
+
+MatchKernel MatchKernels::detectBest()
+{
+    if (isSupported(MatchKernel::AVX512))
+    {
+        return MatchKernel::AVX512;
+    }
+    if (isSupported(MatchKernel::AVX2))
+    {
+        return MatchKernel::AVX2;
+    }
+    if (isSupported(MatchKernel::SSE2))
+    {
+        return MatchKernel::SSE2;
+    }
+    return MatchKernel::Bitboard;
+}
+
+bool MatchKernels::isSupported(MatchKernel kernel)
+{
+    switch (kernel)
+    {
+    case MatchKernel::Auto:
+    case MatchKernel::Bitboard:
+    case MatchKernel::Scalar:
+        return true;
+#ifdef MATCH3_X86
+    case MatchKernel::SSE2:
+        return getCpuFeatures().sse2;
+    case MatchKernel::AVX2:
+        return getCpuFeatures().avx2;
+    case MatchKernel::AVX512:
+        return getCpuFeatures().avx512;
+#endif
+    default:
+        return false;
+    }
+}
+
+TripleScanFn MatchKernels::getTripleScan(MatchKernel kernel)
+{
+    switch (kernel)
+    {
+#ifdef MATCH3_X86
+    case MatchKernel::SSE2:
+        return scanTriplesSSE2;
+    case MatchKernel::AVX2:
+        return scanTriplesAVX2;
+    case MatchKernel::AVX512:
+        return scanTriplesAVX512;
+#endif
+    default:
+        return scanTriplesScalar;
+    }
+}
+
+const char *MatchKernels::getName(MatchKernel kernel)
+{
+    switch (kernel)
+    {
+    case MatchKernel::Auto:
+        return "auto";
+    case MatchKernel::Bitboard:
+        return "bitboard";
+    case MatchKernel::Scalar:
+        return "scalar";
+    case MatchKernel::SSE2:
+        return "sse2";
+    case MatchKernel::AVX2:
+        return "avx2";
+    case MatchKernel::AVX512:
+        return "avx512";
+    default:
+        return "unknown";
+    }
+}
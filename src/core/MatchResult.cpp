@@ -0,0 +1,30 @@
+#include "core/MatchResult.h"
+
+void MatchResult::reset(int width, int height)
+{
+    if (mask.getWidth() != width || mask.getHeight() != height)
+    {
+        mask.resize(width, height);
+    }
+    else
+    {
+        mask.clear();
+    }
+    positions.clear();
+    runs.clear();
+    maskOnly = false;
+    maskFound = false;
+}
+
+void MatchResult::addRun(int row, int col, int length, bool horizontal)
+{
+    runs.push_back(MatchRun{static_cast<int>(positions.size()), length, horizontal});
+
+    for (int k = 0; k < length; k++)
+    {
+        int r = horizontal ? row : row + k;
+        int c = horizontal ? col + k : col;
+        positions.push_back(GridPos(c, r));
+        mask.set(r, c);
+    }
+}
@@ -0,0 +1,65 @@
+#include "core/Rng.h"
+#include <atomic>
+#include <chrono>
+#include <random>
+
+static uint64_t splitMix64(uint64_t &x)
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static uint64_t initialSeed()
+{
+    std::random_device rd;
+    uint64_t seed = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    return seed ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+uint64_t Rng::generateSeed()
+{
+    static std::atomic<uint64_t> counter(initialSeed());
+    uint64_t x = counter.fetch_add(1);
+    return splitMix64(x);
+}
+
+void Rng::drawColors(uint8_t *out, int count, int numColors)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = static_cast<uint8_t>(nextBelow(numColors));
+    }
+}
+
+Xoshiro256Rng::Xoshiro256Rng(uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void Xoshiro256Rng::seed(uint64_t seed)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        state[i] = splitMix64(seed);
+    }
+}
+
+void Xoshiro256Rng::drawColors(uint8_t *out, int count, int numColors)
+{
+    uint64_t bound = static_cast<uint64_t>(numColors);
+    int i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        uint64_t bits = step();
+        out[i] = static_cast<uint8_t>(((bits >> 32) * bound) >> 32);
+        out[i + 1] = static_cast<uint8_t>(((bits & 0xFFFFFFFFull) * bound) >> 32);
+    }
+
+    if (i < count)
+    {
+        out[i] = static_cast<uint8_t>(((step() >> 32) * bound) >> 32);
+    }
+}
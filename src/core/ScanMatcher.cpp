@@ -0,0 +1,89 @@
+#include "core/ScanMatcher.h"
+#include <algorithm>
+
+bool ScanMatcher::findMatches(const Board &board, TripleScanFn scan, BitGrid &mask)
+{
+    int width = board.getWidth();
+    int height = board.getHeight();
+
+    if (mask.getWidth() != width || mask.getHeight() != height)
+    {
+        mask.resize(width, height);
+    }
+    else
+    {
+        mask.clear();
+    }
+
+    return findMatchesInColumns(board, scan, mask, 0, width);
+}
+
+bool ScanMatcher::findMatchesInColumns(const Board &board, TripleScanFn scan, BitGrid &mask, int begin, int end)
+{
+    int width = board.getWidth();
+    int height = board.getHeight();
+    int words = mask.getWordsPerColumn();
+    starts.resize(words);
+    const BitGrid &emptyMask = board.getEmptyMask();
+
+    for (int j = std::max(0, begin - 2); j < end; j++)
+    {
+        const uint8_t *column = board.getColumn(j);
+        const uint64_t *empty = emptyMask.getColumn(j);
+
+        if (j >= begin && height >= 3)
+        {
+            starts[words - 1] = 0;
+            scan(column, column + 1, column + 2, height - 2, starts.data());
+
+            uint64_t *out = mask.getColumn(j);
+            for (int w = 0; w < words; w++)
+            {
+                uint64_t next = (w + 1 < words) ? empty[w + 1] : 0;
+                uint64_t blocked = empty[w] | (empty[w] >> 1) | (next << 63) | (empty[w] >> 2) | (next << 62);
+                uint64_t s = starts[w] & ~blocked;
+
+                if (s == 0)
+                {
+                    continue;
+                }
+
+                out[w] |= s | (s << 1) | (s << 2);
+                if (w + 1 < words)
+                {
+                    out[w + 1] |= (s >> 63) | (s >> 62);
+                }
+            }
+        }
+
+        if (j + 2 < width)
+        {
+            scan(column, board.getColumn(j + 1), board.getColumn(j + 2), height, starts.data());
+
+            const uint64_t *empty1 = emptyMask.getColumn(j + 1);
+            const uint64_t *empty2 = emptyMask.getColumn(j + 2);
+            int first = std::max(j, begin);
+            int last = std::min(j + 3, end);
+            for (int w = 0; w < words; w++)
+            {
+                uint64_t s = starts[w] & ~(empty[w] | empty1[w] | empty2[w]);
+                if (s != 0)
+                {
+                    for (int k = first; k < last; k++)
+                    {
+                        mask.getColumn(k)[w] |= s;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int j = begin; j < end; j++)
+    {
+        if (mask.anyInColumn(j))
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -72,10 +72,11 @@ void SceneManager::update(float deltaTime)
     }
 }
 
-void SceneManager::render()
+void SceneManager::render(float interpolation)
 {
     if (hasActiveScene())
     {
+        getCurrentScene()->setInterpolation(interpolation);
         getCurrentScene()->render(window);
     }
 }
@@ -85,6 +86,11 @@ bool SceneManager::hasActiveScene() const
     return !sceneStack.empty();
 }
 
+bool SceneManager::isAnimating() const
+{
+    return hasActiveScene() && scenes.at(sceneStack.top())->isAnimating();
+}
+
 Scene *SceneManager::getCurrentScene()
 {
     if (sceneStack.empty())
@@ -0,0 +1,100 @@
+#include "core/ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threadCount)
+{
+    if (threadCount <= 0)
+    {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        workers.emplace_back(&ThreadPool::run, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    startCondition.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(int count, const std::function<void(int)> &body)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+    if (workers.empty() || count == 1)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            body(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &body;
+        jobCount = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        busyWorkers = static_cast<int>(workers.size());
+        jobId++;
+    }
+    startCondition.notify_all();
+
+    runIndices(body, count);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondition.wait(lock, [this]()
+                       { return busyWorkers == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::runIndices(const std::function<void(int)> &body, int count)
+{
+    for (int i = nextIndex.fetch_add(1, std::memory_order_relaxed); i < count;
+         i = nextIndex.fetch_add(1, std::memory_order_relaxed))
+    {
+        body(i);
+    }
+}
+
+void ThreadPool::run()
+{
+    uint64_t seenJob = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        startCondition.wait(lock, [this, seenJob]()
+                            { return stopping || jobId != seenJob; });
+        if (stopping)
+        {
+            return;
+        }
+
+        seenJob = jobId;
+        const std::function<void(int)> &body = *job;
+        int count = jobCount;
+        lock.unlock();
+
+        runIndices(body, count);
+
+        lock.lock();
+        if (--busyWorkers == 0)
+        {
+            doneCondition.notify_one();
+        }
+    }
+}
@@ -3,7 +3,10 @@
 #include "ui/MainMenu.h"
 #include "ui/SettingsScene.h"
 #include "ui/GameBoard.h"
+#include "ui/PerfOverlay.h"
 #include "utils/KeyboardMonitor.h"
+#include "utils/PerfStats.h"
+#include "utils/RenderStats.h"
 
 int main()
 {
@@ -25,21 +28,94 @@ int main()
     keyboardMonitor.setCallback(GlobalKey::Backspace, [&sceneManager]()
                                 { sceneManager.popScene(); });
 
+#ifdef MATCH3_PERF_OVERLAY
+    PerfOverlay perfOverlay;
+    keyboardMonitor.setCallback(GlobalKey::F3, [&perfOverlay]()
+                                { perfOverlay.toggle(); });
+#endif
+
+    const sf::Time backgroundFrameTime = sf::milliseconds(100);
+    bool needsRedraw = true;
+
+    const sf::Time tickTime = sf::seconds(1.f / 60.f);
+    const int maxTicksPerFrame = 8;
+    sf::Clock frameClock;
+    sf::Time accumulator = sf::Time::Zero;
+
     while (window.isOpen())
     {
-        while (const std::optional event = window.pollEvent())
+        bool animating = sceneManager.isAnimating();
+
+        std::optional<sf::Event> event;
+        if (!animating && !needsRedraw)
+        {
+            event = window.waitEvent();
+        }
+        else if (animating && !window.hasFocus())
+        {
+            event = window.waitEvent(backgroundFrameTime);
+        }
+        else
+        {
+            event = window.pollEvent();
+        }
+
+        MATCH3_PERF_BEGIN_FRAME();
+        {
+            MATCH3_PERF_SCOPE(Events);
+            for (; event; event = window.pollEvent())
+            {
+                if (event->is<sf::Event::Closed>())
+                {
+                    window.close();
+                }
+
+                keyboardMonitor.handleEvent(event.value());
+                sceneManager.handleEvent(event.value());
+                needsRedraw = true;
+            }
+        }
+
+        sf::Time elapsed = frameClock.restart();
+        if (animating)
         {
-            if (event->is<sf::Event::Closed>())
+            accumulator += elapsed;
+        }
+
+        {
+            MATCH3_PERF_SCOPE(Update);
+            int ticks = 0;
+            while (accumulator >= tickTime && ticks < maxTicksPerFrame)
             {
-                window.close();
+                sceneManager.update(tickTime.asSeconds());
+                accumulator -= tickTime;
+                ticks++;
             }
+        }
+        if (accumulator >= tickTime)
+        {
+            accumulator = sf::Time::Zero;
+        }
 
-            keyboardMonitor.handleEvent(event.value());
-            sceneManager.handleEvent(event.value());
+        if (!window.isOpen() || (!animating && !needsRedraw))
+        {
+            continue;
         }
 
-        window.clear(sf::Color(245, 245, 245));
-        sceneManager.render();
-        window.display();
+        RenderStats::getInstance().beginFrame();
+        {
+            MATCH3_PERF_SCOPE(Render);
+            window.clear(sf::Color(245, 245, 245));
+            sceneManager.render(sceneManager.isAnimating() ? accumulator / tickTime : 1.f);
+#ifdef MATCH3_PERF_OVERLAY
+            perfOverlay.draw(window);
+#endif
+        }
+        {
+            MATCH3_PERF_SCOPE(Display);
+            window.display();
+        }
+        MATCH3_PERF_END_FRAME();
+        needsRedraw = false;
     }
 }
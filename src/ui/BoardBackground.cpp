@@ -0,0 +1,68 @@
+#include "ui/BoardBackground.h"
+#include "utils/RenderStats.h"
+
+BoardBackground::BoardBackground()
+    : buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static)
+{
+}
+
+void BoardBackground::build(int newWidth, int newHeight, float newTileSize)
+{
+    width = newWidth;
+    height = newHeight;
+    tileSize = newTileSize;
+
+    vertices.clear();
+
+    addRect(sf::Vector2f(0.f, 0.f), sf::Vector2f(width * tileSize, height * tileSize), sf::Color(245, 245, 245));
+
+    sf::Color lineColor(180, 180, 180, 200);
+    for (int i = 0; i <= height; i++)
+    {
+        addRect(sf::Vector2f(0.f, i * tileSize), sf::Vector2f(width * tileSize, 2.f), lineColor);
+    }
+    for (int i = 0; i <= width; i++)
+    {
+        addRect(sf::Vector2f(i * tileSize, 0.f), sf::Vector2f(2.f, height * tileSize), lineColor);
+    }
+
+    useBuffer = sf::VertexBuffer::isAvailable() && buffer.create(vertices.size()) && buffer.update(vertices.data());
+}
+
+bool BoardBackground::isBuiltFor(int otherWidth, int otherHeight, float otherTileSize) const
+{
+    return !vertices.empty() && width == otherWidth && height == otherHeight && tileSize == otherTileSize;
+}
+
+void BoardBackground::draw(sf::RenderTarget &target) const
+{
+    if (vertices.empty())
+    {
+        return;
+    }
+
+    if (useBuffer)
+    {
+        target.draw(buffer);
+    }
+    else
+    {
+        target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+    }
+    RenderStats::getInstance().recordDraw(vertices.size());
+}
+
+void BoardBackground::addRect(const sf::Vector2f &position, const sf::Vector2f &size, const sf::Color &color)
+{
+    sf::Vertex topLeft{position, color};
+    sf::Vertex topRight{position + sf::Vector2f(size.x, 0.f), color};
+    sf::Vertex bottomLeft{position + sf::Vector2f(0.f, size.y), color};
+    sf::Vertex bottomRight{position + size, color};
+
+    vertices.push_back(topLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomRight);
+    vertices.push_back(topLeft);
+    vertices.push_back(bottomRight);
+    vertices.push_back(bottomLeft);
+}
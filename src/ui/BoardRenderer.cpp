@@ -0,0 +1,98 @@
+#include "ui/BoardRenderer.h"
+#include "utils/ColorManager.h"
+#include "utils/RenderStats.h"
+
+BoardRenderer::BoardRenderer()
+    : vertices(sf::PrimitiveType::Triangles)
+{
+}
+
+void BoardRenderer::clear()
+{
+    vertices.clear();
+}
+
+void BoardRenderer::addTile(int colorIndex, const sf::Vector2f &position, float scale)
+{
+    if (!atlas)
+    {
+        return;
+    }
+
+    float half = atlas->getShapeSize() / 2.f;
+    sf::Vector2f center = position + sf::Vector2f(half, half);
+
+    if (atlas->isValid())
+    {
+        addTexturedTile(colorIndex, center, scale);
+    }
+    else
+    {
+        addShapeTile(colorIndex, center, scale);
+    }
+}
+
+void BoardRenderer::addTexturedTile(int colorIndex, const sf::Vector2f &center, float scale)
+{
+    if (colorIndex < 0 || colorIndex >= static_cast<int>(ColorManager::getAllColors().size()))
+    {
+        return;
+    }
+
+    bool selected = scale > 1.0f;
+    float cellScale = selected ? scale / atlas->getSelectedScale() : scale;
+    float half = atlas->getCellSize() * cellScale / 2.f;
+
+    sf::FloatRect rect = atlas->getTextureRect(colorIndex, selected);
+    sf::Vector2f texMin = rect.position;
+    sf::Vector2f texMax = rect.position + rect.size;
+
+    sf::Vertex topLeft{center + sf::Vector2f(-half, -half), sf::Color::White, texMin};
+    sf::Vertex topRight{center + sf::Vector2f(half, -half), sf::Color::White, sf::Vector2f(texMax.x, texMin.y)};
+    sf::Vertex bottomLeft{center + sf::Vector2f(-half, half), sf::Color::White, sf::Vector2f(texMin.x, texMax.y)};
+    sf::Vertex bottomRight{center + sf::Vector2f(half, half), sf::Color::White, texMax};
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+    vertices.append(topLeft);
+    vertices.append(bottomRight);
+    vertices.append(bottomLeft);
+}
+
+void BoardRenderer::addShapeTile(int colorIndex, const sf::Vector2f &center, float scale)
+{
+    fallbackShape.setSize(sf::Vector2f(atlas->getShapeSize(), atlas->getShapeSize()));
+    fallbackShape.setCornerRadius(atlas->getCornerRadius());
+
+    const std::vector<sf::Vector2f> &outline = fallbackShape.getOutline();
+    sf::Color color = ColorManager::getColor(colorIndex);
+    sf::Vector2f half = fallbackShape.getSize() / 2.f;
+
+    sf::Vector2f previous = center + (outline.back() - half) * scale;
+    for (const sf::Vector2f &local : outline)
+    {
+        sf::Vector2f point = center + (local - half) * scale;
+        vertices.append(sf::Vertex{center, color});
+        vertices.append(sf::Vertex{previous, color});
+        vertices.append(sf::Vertex{point, color});
+        previous = point;
+    }
+}
+
+void BoardRenderer::draw(sf::RenderTarget &target) const
+{
+    if (vertices.getVertexCount() == 0)
+    {
+        return;
+    }
+
+    sf::RenderStates states;
+    if (atlas && atlas->isValid())
+    {
+        states.texture = &atlas->getTexture();
+    }
+
+    target.draw(vertices, states);
+    RenderStats::getInstance().recordDraw(vertices.getVertexCount());
+}
@@ -1,18 +1,55 @@
 #include "ui/GameBoard.h"
-#include "utils/ColorManager.h"
 #include "utils/GameConfig.h"
+#include "utils/PerfStats.h"
 #include <algorithm>
 #include <cmath>
 
+static const char *gameStateName(GameState state)
+{
+    switch (state)
+    {
+    case GameState::Loading:
+        return "Loading";
+    case GameState::Swapping:
+        return "Swapping";
+    case GameState::FallingInitial:
+        return "FallingInitial";
+    case GameState::CheckingMatches:
+        return "CheckingMatches";
+    case GameState::ClearingMatches:
+        return "ClearingMatches";
+    case GameState::FallingAfterClear:
+        return "FallingAfterClear";
+    default:
+        return "Idle";
+    }
+}
+
+static BoardConfig currentBoardConfig()
+{
+    GameConfig &config = GameConfig::getInstance();
+
+    BoardConfig board;
+    board.width = config.getGridSize().x;
+    board.height = config.getGridSize().y;
+    board.colors = config.getSelectedColorIndices();
+    if (board.colors.empty())
+    {
+        board.colors = {0, 1, 2, 3, 4, 5};
+    }
+    board.numColors = static_cast<int>(board.colors.size());
+    return board;
+}
+
 GameBoard::GameBoard(float windowSize)
     : windowSize(windowSize)
 {
+    simulation.prepare(currentBoardConfig());
 }
 
 void GameBoard::onEnter()
 {
     initializeGame();
-    startFallAnimation();
 }
 
 void GameBoard::handleEvent(const sf::Event &event)
@@ -32,7 +69,7 @@ void GameBoard::handleEvent(const sf::Event &event)
             int col = static_cast<int>(mousePos.x / tileSize);
             int row = static_cast<int>(mousePos.y / tileSize);
 
-            if (row >= 0 && row < gameLogic->getHeight() && col >= 0 && col < gameLogic->getWidth())
+            if (row >= 0 && row < boardHeight && col >= 0 && col < boardWidth)
             {
                 isDragging = true;
                 dragStartTile = sf::Vector2i(col, row);
@@ -82,8 +119,8 @@ void GameBoard::handleEvent(const sf::Event &event)
                     }
                 }
                 
-                if (newTargetTile.x >= 0 && newTargetTile.x < gameLogic->getWidth() &&
-                    newTargetTile.y >= 0 && newTargetTile.y < gameLogic->getHeight())
+                if (newTargetTile.x >= 0 && newTargetTile.x < boardWidth &&
+                    newTargetTile.y >= 0 && newTargetTile.y < boardHeight)
                 {
                     dragTargetTile = newTargetTile;
                 }
@@ -125,32 +162,34 @@ void GameBoard::handleEvent(const sf::Event &event)
 
 void GameBoard::render(sf::RenderWindow &window)
 {
-    if (!gameLogic || shapes.empty())
+    if (tiles.empty())
     {
         return;
     }
 
-    if (gameState != GameState::Idle)
-    {
-        updateAnimation();
-    }
-    else if (scalingTile.x != -1)
-    {
-    }
+    MATCH3_PERF_SET_ANIMATIONS(tweens.size());
+    MATCH3_PERF_SET_STATE(gameStateName(gameState));
 
     drawGrid(window);
     
-    int height = gameLogic->getHeight();
-    int width = gameLogic->getWidth();
+    if (gameState == GameState::Loading)
+    {
+        return;
+    }
+
+    int height = boardHeight;
+    int width = boardWidth;
     
-    if (static_cast<int>(shapes.size()) < height)
+    if (static_cast<int>(tiles.size()) < height)
     {
         return;
     }
+
+    boardRenderer.clear();
     
     for (int i = 0; i < height; i++)
     {
-        if (static_cast<int>(shapes[i].size()) < width)
+        if (static_cast<int>(tiles[i].size()) < width)
         {
             continue;
         }
@@ -165,7 +204,7 @@ void GameBoard::render(sf::RenderWindow &window)
             {
                 continue;
             }
-            window.draw(shapes[i][j]);
+            boardRenderer.addTile(tiles[i][j].colorIndex, getDrawPosition(tiles[i][j]));
         }
     }
 
@@ -193,299 +232,272 @@ void GameBoard::render(sf::RenderWindow &window)
             clampedDelta.y = std::max(-tileSize, std::min(tileSize, delta.y));
         }
         
-        RoundedRectangle draggedShape = shapes[dragStartTile.y][dragStartTile.x];
-        draggedShape.setPosition(startTileBasePos + clampedDelta);
-        window.draw(draggedShape);
+        boardRenderer.addTile(tiles[dragStartTile.y][dragStartTile.x].colorIndex, startTileBasePos + clampedDelta);
         
         if (dragTargetTile.x != -1 && dragTargetTile.y != -1)
         {
             sf::Vector2f targetTileBasePos(dragTargetTile.x * tileSize + padding,
                                            dragTargetTile.y * tileSize + padding);
             
-            RoundedRectangle targetShape = shapes[dragTargetTile.y][dragTargetTile.x];
-            targetShape.setPosition(targetTileBasePos - clampedDelta);
-            window.draw(targetShape);
+            boardRenderer.addTile(tiles[dragTargetTile.y][dragTargetTile.x].colorIndex, targetTileBasePos - clampedDelta);
+        }
+    }
+
+    addSelectedHighlight();
+    boardRenderer.draw(window);
+}
+
+void GameBoard::update(float deltaTime)
+{
+    if (tiles.empty())
+    {
+        return;
+    }
+
+    if (gameState == GameState::Loading)
+    {
+        if (receiveSnapshot())
+        {
+            beginReplay();
+            startFallAnimation(simulation.getSnapshot().initialColors);
         }
+        return;
     }
 
-    drawSelectedHighlight(window);
+    settleMovedTiles();
+
+    simulationTime += deltaTime;
+    updateScale(deltaTime);
+
+    if (gameState != GameState::Idle)
+    {
+        updateAnimation();
+    }
+
+    if (gameState == GameState::Idle)
+    {
+        settleMovedTiles();
+    }
+}
+
+void GameBoard::settleMovedTiles()
+{
+    int width = boardWidth;
+    for (int entity : movedTiles)
+    {
+        TileSprite &tile = tiles[entity / width][entity % width];
+        tile.previousPosition = tile.position;
+    }
+    movedTiles.clear();
+}
+
+bool GameBoard::isAnimating() const
+{
+    return gameState != GameState::Idle || scalingTile.x != -1;
 }
 
 void GameBoard::initializeGame()
 {
-    GameConfig &config = GameConfig::getInstance();
-    sf::Vector2i gridSize = config.getGridSize();
-    int numColors = config.getNumColors();
-    
-    gameLogic = std::make_shared<GameLogic>(gridSize.x, gridSize.y, numColors);
-    gameLogic->initialize();
+    BoardConfig config = currentBoardConfig();
     
-    int height = gameLogic->getHeight();
-    int width = gameLogic->getWidth();
+    boardWidth = config.width;
+    boardHeight = config.height;
     
-    shapes.clear();
-    shapes.resize(height);
-    for (int i = 0; i < height; i++)
+    tiles.clear();
+    tiles.resize(boardHeight);
+    for (int i = 0; i < boardHeight; i++)
     {
-        shapes[i].resize(width);
+        tiles[i].resize(boardWidth);
     }
     
     initializeShapes();
+
+    awaitingSequence = simulation.start(config);
+    gameState = GameState::Loading;
 }
 
 void GameBoard::initializeShapes()
 {
-    int width = gameLogic->getWidth();
-    int height = gameLogic->getHeight();
+    int width = boardWidth;
+    int height = boardHeight;
     float tileSize = getTileSize();
     float padding = getPadding();
     float cornerRadius = tileSize * 0.2f;
     float shapeSize = tileSize - padding * 2;
 
-    targetPositions.clear();
-    targetPositions.resize(height);
-    startPositions.clear();
-    startPositions.resize(height);
+    tileAtlas.build(shapeSize, cornerRadius, 1.18f);
+    boardRenderer.setAtlas(&tileAtlas);
+    if (!background.isBuiltFor(width, height, tileSize))
+    {
+        background.build(width, height, tileSize);
+    }
+    tweens.clear();
 
     for (int i = 0; i < height; i++)
     {
-        targetPositions[i].resize(width);
-        startPositions[i].resize(width);
-        
         for (int j = 0; j < width; j++)
         {
-            float x = j * tileSize + padding;
-            float y = i * tileSize + padding;
-
-            targetPositions[i][j] = sf::Vector2f(x, y);
-            startPositions[i][j] = sf::Vector2f(x, -windowSize);
-
-            shapes[i][j].setSize(sf::Vector2f(shapeSize, shapeSize));
-            shapes[i][j].setPosition(startPositions[i][j]);
-            shapes[i][j].setCornerRadius(cornerRadius);
-            
-            int colorIndex = gameLogic->getColorIndex(i, j);
-            shapes[i][j].setFillColor(ColorManager::getColor(colorIndex));
+            tiles[i][j].position = sf::Vector2f(getTilePosition(i, j).x, -windowSize);
+            tiles[i][j].previousPosition = tiles[i][j].position;
+            tiles[i][j].colorIndex = -1;
         }
     }
 }
 
 void GameBoard::updateAnimation()
 {
-    float elapsed = animationClock.getElapsedTime().asSeconds();
-    float duration = (gameState == GameState::Swapping) ? 0.3f : 0.8f;
-    
-    if (elapsed >= duration)
-    {
-        int height = gameLogic->getHeight();
-        int width = gameLogic->getWidth();
-        
-        if (gameState == GameState::Swapping)
-        {
-            shapes[swapTile1.y][swapTile1.x].setPosition(targetPositions[swapTile1.y][swapTile1.x]);
-            shapes[swapTile2.y][swapTile2.x].setPosition(targetPositions[swapTile2.y][swapTile2.x]);
-
-            auto matches = gameLogic->findMatches();
-            if (matches.empty() && !isSwapReversing)
-            {
-                isSwapReversing = true;
-                gameLogic->swapTiles(swapTile1.y, swapTile1.x, swapTile2.y, swapTile2.x);
+    int width = boardWidth;
 
-                float tileSize = getTileSize();
-                float padding = getPadding();
-                
-                startPositions[swapTile1.y][swapTile1.x] = targetPositions[swapTile1.y][swapTile1.x];
-                targetPositions[swapTile1.y][swapTile1.x] = sf::Vector2f(swapTile1.x * tileSize + padding, swapTile1.y * tileSize + padding);
+    tweens.update(simulationTime, [this, width](int entity, const sf::Vector2f &position)
+                  {
+                      tiles[entity / width][entity % width].position = position;
+                      movedTiles.push_back(entity);
+                  });
 
-                startPositions[swapTile2.y][swapTile2.x] = targetPositions[swapTile2.y][swapTile2.x];
-                targetPositions[swapTile2.y][swapTile2.x] = sf::Vector2f(swapTile2.x * tileSize + padding, swapTile2.y * tileSize + padding);
+    if (!tweens.empty())
+    {
+        return;
+    }
 
-                animationClock.restart();
-                return;
-            }
-            else
-            {
-                gameState = GameState::CheckingMatches;
-                checkAndClearMatches();
-            }
+    if (gameState == GameState::Swapping && !isSwapReversing)
+    {
+        if (!receiveSnapshot())
+        {
+            return;
         }
-        else
+
+        beginReplay();
+        if (!simulation.getSnapshot().swapValid)
         {
-            for (int i = 0; i < height; i++)
-            {
-                for (int j = 0; j < width; j++)
-                {
-                    shapes[i][j].setPosition(targetPositions[i][j]);
-                }
-            }
-            
-            if (gameState == GameState::FallingInitial)
-            {
-                gameState = GameState::CheckingMatches;
-                checkAndClearMatches();
-            }
-            else if (gameState == GameState::FallingAfterClear)
-            {
-                gameState = GameState::CheckingMatches;
-                checkAndClearMatches();
-            }
+            isSwapReversing = true;
+            swapTileSprites(swapTile1, swapTile2);
+            return;
         }
-        
-        return;
     }
-    
-    float t = elapsed / duration;
-    
-    if (gameState == GameState::Swapping)
-    {
-        sf::Vector2f startPos1 = startPositions[swapTile1.y][swapTile1.x];
-        sf::Vector2f targetPos1 = targetPositions[swapTile1.y][swapTile1.x];
-        sf::Vector2f pos1 = startPos1 + (targetPos1 - startPos1) * t;
-        shapes[swapTile1.y][swapTile1.x].setPosition(pos1);
 
-        sf::Vector2f startPos2 = startPositions[swapTile2.y][swapTile2.x];
-        sf::Vector2f targetPos2 = targetPositions[swapTile2.y][swapTile2.x];
-        sf::Vector2f pos2 = startPos2 + (targetPos2 - startPos2) * t;
-        shapes[swapTile2.y][swapTile2.x].setPosition(pos2);
+    gameState = GameState::CheckingMatches;
+    checkAndClearMatches();
+}
 
-        return;
-    }
-    
-    int height = gameLogic->getHeight();
-    int width = gameLogic->getWidth();
-    
-    for (int i = 0; i < height; i++)
+bool GameBoard::receiveSnapshot()
+{
+    if (snapshotSequence != awaitingSequence && simulation.pollSnapshot())
     {
-        for (int j = 0; j < width; j++)
-        {
-            sf::Vector2f startPos = startPositions[i][j];
-            sf::Vector2f targetPos = targetPositions[i][j];
-            
-            float distance = targetPos.y - startPos.y;
-            float y = startPos.y + distance * t * t;
-            
-            shapes[i][j].setPosition(sf::Vector2f(targetPos.x, y));
-        }
+        snapshotSequence = simulation.getSnapshot().sequence;
     }
+    return awaitingSequence != 0 && snapshotSequence == awaitingSequence;
 }
 
-void GameBoard::startFallAnimation(const std::vector<sf::Vector2i> &affectedColumns)
+void GameBoard::beginReplay()
 {
-    int height = gameLogic->getHeight();
-    int width = gameLogic->getWidth();
-    float tileSize = getTileSize();
-    float padding = getPadding();
-    
-    for (int i = 0; i < height; i++)
+    nextCascadeStep = 0;
+    reshufflePending = simulation.getSnapshot().reshuffled;
+}
+
+void GameBoard::startFallAnimation(const std::vector<int> &colors)
+{
+    for (int i = 0; i < boardHeight; i++)
     {
-        for (int j = 0; j < width; j++)
+        for (int j = 0; j < boardWidth; j++)
         {
-            float x = j * tileSize + padding;
-            float y = i * tileSize + padding;
-            targetPositions[i][j] = sf::Vector2f(x, y);
-            startPositions[i][j] = sf::Vector2f(x, -windowSize);
-            
-            int colorIndex = gameLogic->getColorIndex(i, j);
-            shapes[i][j].setFillColor(ColorManager::getColor(colorIndex));
+            tiles[i][j].colorIndex = colors[i * boardWidth + j];
+            addTween(i, j, sf::Vector2f(getTilePosition(i, j).x, -windowSize), 0.8f, Easing::EaseInQuad);
         }
     }
     
     gameState = GameState::FallingInitial;
-    animationClock.restart();
 }
 
 void GameBoard::checkAndClearMatches()
 {
-    auto matches = gameLogic->findMatches();
-    
-    if (!matches.empty())
+    const BoardSnapshot &snapshot = simulation.getSnapshot();
+    const CascadeTrace &trace = snapshot.trace;
+
+    if (nextCascadeStep < trace.getStepCount())
     {
         gameState = GameState::ClearingMatches;
-        
-        int height = gameLogic->getHeight();
-        int width = gameLogic->getWidth();
+
         float tileSize = getTileSize();
-        float padding = getPadding();
-        
-        std::vector<std::vector<int>> oldColorIndices(height);
-        for (int i = 0; i < height; i++)
+
+        const CascadeStep &step = trace.getStep(nextCascadeStep++);
+        spawnCounts.assign(boardWidth, 0);
+        for (int k = step.spawnBegin; k < step.spawnEnd; k++)
         {
-            oldColorIndices[i].resize(width);
-            for (int j = 0; j < width; j++)
-            {
-                oldColorIndices[i][j] = gameLogic->getColorIndex(i, j);
-            }
+            spawnCounts[trace.getColumn(trace.getSpawns()[k].cell)]++;
         }
-        
-        gameLogic->clearMatches(matches);
-        
-        std::vector<int> numCleared(width, 0);
-        for (int j = 0; j < width; j++)
+
+        // Falls are recorded bottom-up per column, so each source is read
+        // before a later fall overwrites it.
+        for (int k = step.fallBegin; k < step.fallEnd; k++)
         {
-            for (int i = 0; i < height; i++)
-            {
-                if (gameLogic->isEmpty(i, j))
-                {
-                    numCleared[j]++;
-                }
-            }
+            const TileFall &fall = trace.getFalls()[k];
+            int i = trace.getRow(fall.cell);
+            int j = trace.getColumn(fall.cell);
+            tiles[i][j].colorIndex = tiles[i - fall.distance][j].colorIndex;
+            addTween(i, j, getTilePosition(i, j) - sf::Vector2f(0.f, fall.distance * tileSize), 0.8f, Easing::EaseInQuad);
         }
-        
-        auto affectedColumns = gameLogic->applyGravity();
-        gameLogic->fillEmptySpaces();
-        
-        for (int j = 0; j < width; j++)
+
+        for (int k = step.spawnBegin; k < step.spawnEnd; k++)
         {
-            int cleared = numCleared[j];
-            
-            if (cleared > 0)
-            {
-                for (int i = 0; i < height; i++)
-                {
-                    float x = j * tileSize + padding;
-                    float y = i * tileSize + padding;
-                    targetPositions[i][j] = sf::Vector2f(x, y);
-                    
-                    if (i < cleared)
-                    {
-                        startPositions[i][j] = sf::Vector2f(x, -(cleared - i) * tileSize);
-                    }
-                    else
-                    {
-                        startPositions[i][j] = sf::Vector2f(x, (i - cleared) * tileSize + padding);
-                    }
-                    
-                    int colorIndex = gameLogic->getColorIndex(i, j);
-                    shapes[i][j].setFillColor(ColorManager::getColor(colorIndex));
-                }
-            }
-            else
-            {
-                for (int i = 0; i < height; i++)
-                {
-                    float x = j * tileSize + padding;
-                    float y = i * tileSize + padding;
-                    targetPositions[i][j] = sf::Vector2f(x, y);
-                    startPositions[i][j] = sf::Vector2f(x, y);
-                }
-            }
+            const TileSpawn &spawn = trace.getSpawns()[k];
+            int i = trace.getRow(spawn.cell);
+            int j = trace.getColumn(spawn.cell);
+            tiles[i][j].colorIndex = snapshot.availableColors[spawn.color];
+            addTween(i, j, getTilePosition(i, j) - sf::Vector2f(0.f, spawnCounts[j] * tileSize), 0.8f, Easing::EaseInQuad);
         }
-        
+
         gameState = GameState::FallingAfterClear;
-        animationClock.restart();
     }
     else
     {
         gameState = GameState::Idle;
+
+        if (reshufflePending)
+        {
+            reshufflePending = false;
+            startFallAnimation(snapshot.finalColors);
+        }
     }
 }
 
+void GameBoard::addTween(int row, int col, const sf::Vector2f &start, float duration, Easing easing)
+{
+    if (tweens.empty())
+    {
+        simulationTime = 0.0f;
+    }
+
+    tiles[row][col].position = start;
+    tiles[row][col].previousPosition = start;
+    tweens.add(row * boardWidth + col, start, getTilePosition(row, col), simulationTime, duration, easing);
+}
+
+void GameBoard::swapTileSprites(const sf::Vector2i &tile1, const sf::Vector2i &tile2)
+{
+    TileSprite &first = tiles[tile1.y][tile1.x];
+    TileSprite &second = tiles[tile2.y][tile2.x];
+    std::swap(first, second);
+
+    addTween(tile1.y, tile1.x, first.position, 0.3f, Easing::Linear);
+    addTween(tile2.y, tile2.x, second.position, 0.3f, Easing::Linear);
+}
+
+sf::Vector2f GameBoard::getDrawPosition(const TileSprite &tile) const
+{
+    return tile.previousPosition + (tile.position - tile.previousPosition) * interpolation;
+}
+
+sf::Vector2f GameBoard::getTilePosition(int row, int col) const
+{
+    float tileSize = getTileSize();
+    float padding = getPadding();
+    return sf::Vector2f(col * tileSize + padding, row * tileSize + padding);
+}
+
 float GameBoard::getTileSize() const
 {
-    if (!gameLogic) return 0.0f;
-    int width = gameLogic->getWidth();
-    int height = gameLogic->getHeight();
-    int maxDim = std::max(width, height);
+    if (boardWidth == 0) return 0.0f;
+    int maxDim = std::max(boardWidth, boardHeight);
     return windowSize / maxDim;
 }
 
@@ -504,7 +516,8 @@ void GameBoard::handleTileClick(int row, int col)
         scalingTile = clickedTile;
         currentScale = 1.0f;
         targetScale = 1.18f;
-        scaleClock.restart();
+        scaleTime = 0.0f;
+        previousScaleTime = 0.0f;
     }
     else
     {
@@ -513,7 +526,8 @@ void GameBoard::handleTileClick(int row, int col)
             scalingTile = selectedTile;
             currentScale = 1.18f;
             targetScale = 1.0f;
-            scaleClock.restart();
+            scaleTime = 0.0f;
+            previousScaleTime = 0.0f;
             selectedTile = sf::Vector2i(-1, -1);
         }
         else if (areAdjacent(selectedTile, clickedTile))
@@ -521,7 +535,8 @@ void GameBoard::handleTileClick(int row, int col)
             scalingTile = selectedTile;
             currentScale = 1.18f;
             targetScale = 1.0f;
-            scaleClock.restart();
+            scaleTime = 0.0f;
+            previousScaleTime = 0.0f;
             pendingSwapTile1 = selectedTile;
             pendingSwapTile2 = clickedTile;
             selectedTile = sf::Vector2i(-1, -1);
@@ -531,7 +546,8 @@ void GameBoard::handleTileClick(int row, int col)
             scalingTile = selectedTile;
             currentScale = 1.18f;
             targetScale = 1.0f;
-            scaleClock.restart();
+            scaleTime = 0.0f;
+            previousScaleTime = 0.0f;
             selectedTile = clickedTile;
         }
     }
@@ -539,15 +555,20 @@ void GameBoard::handleTileClick(int row, int col)
 
 void GameBoard::startSwapAnimation(const sf::Vector2i &tile1, const sf::Vector2i &tile2)
 {
+    uint64_t sequence = simulation.requestSwap(Move{tile1.y, tile1.x, tile2.y, tile2.x});
+    if (sequence == 0)
+    {
+        return;
+    }
+    awaitingSequence = sequence;
+
     swapTile1 = tile1;
     swapTile2 = tile2;
     isSwapReversing = false;
 
-    float tileSize = getTileSize();
-    float padding = getPadding();
-
     if (isDragging)
     {
+        float tileSize = getTileSize();
         sf::Vector2f delta = dragCurrentPos - dragStartPos;
         float absDx = std::abs(delta.x);
         float absDy = std::abs(delta.y);
@@ -564,25 +585,13 @@ void GameBoard::startSwapAnimation(const sf::Vector2i &tile1, const sf::Vector2i
             clampedDelta.y = std::max(-tileSize, std::min(tileSize, delta.y));
         }
         
-        sf::Vector2f tile1BasePos(tile1.x * tileSize + padding, tile1.y * tileSize + padding);
-        sf::Vector2f tile2BasePos(tile2.x * tileSize + padding, tile2.y * tileSize + padding);
-        
-        startPositions[tile1.y][tile1.x] = tile1BasePos + clampedDelta;
-        startPositions[tile2.y][tile2.x] = tile2BasePos - clampedDelta;
-    }
-    else
-    {
-        startPositions[tile1.y][tile1.x] = shapes[tile1.y][tile1.x].getPosition();
-        startPositions[tile2.y][tile2.x] = shapes[tile2.y][tile2.x].getPosition();
+        tiles[tile1.y][tile1.x].position = getTilePosition(tile1.y, tile1.x) + clampedDelta;
+        tiles[tile2.y][tile2.x].position = getTilePosition(tile2.y, tile2.x) - clampedDelta;
     }
 
-    targetPositions[tile1.y][tile1.x] = sf::Vector2f(tile2.x * tileSize + padding, tile2.y * tileSize + padding);
-    targetPositions[tile2.y][tile2.x] = sf::Vector2f(tile1.x * tileSize + padding, tile1.y * tileSize + padding);
-
-    gameLogic->swapTiles(tile1.y, tile1.x, tile2.y, tile2.x);
+    swapTileSprites(tile1, tile2);
 
     gameState = GameState::Swapping;
-    animationClock.restart();
 }
 
 bool GameBoard::areAdjacent(const sf::Vector2i &tile1, const sf::Vector2i &tile2) const
@@ -592,92 +601,56 @@ bool GameBoard::areAdjacent(const sf::Vector2i &tile1, const sf::Vector2i &tile2
     return (dx == 1 && dy == 0) || (dx == 0 && dy == 1);
 }
 
-void GameBoard::drawSelectedHighlight(sf::RenderWindow &window)
+void GameBoard::updateScale(float deltaTime)
+{
+    if (scalingTile.x == -1)
+    {
+        return;
+    }
+
+    previousScaleTime = scaleTime;
+    scaleTime += deltaTime;
+    if (scaleTime < 0.15f)
+    {
+        return;
+    }
+
+    scalingTile = sf::Vector2i(-1, -1);
+
+    if (targetScale == 1.0f && pendingSwapTile1.x != -1 && pendingSwapTile2.x != -1)
+    {
+        startSwapAnimation(pendingSwapTile1, pendingSwapTile2);
+        pendingSwapTile1 = sf::Vector2i(-1, -1);
+        pendingSwapTile2 = sf::Vector2i(-1, -1);
+    }
+}
+
+void GameBoard::addSelectedHighlight()
 {
     if (scalingTile.x != -1 && scalingTile.y != -1)
     {
-        float elapsed = scaleClock.getElapsedTime().asSeconds();
+        float elapsed = previousScaleTime + (scaleTime - previousScaleTime) * interpolation;
         float duration = 0.15f;
         float t = std::min(elapsed / duration, 1.0f);
         
         float scale = currentScale + (targetScale - currentScale) * t;
-        
-        if (t >= 1.0f && targetScale == 1.0f)
-        {
-            scalingTile = sf::Vector2i(-1, -1);
-            
-            if (pendingSwapTile1.x != -1 && pendingSwapTile2.x != -1)
-            {
-                startSwapAnimation(pendingSwapTile1, pendingSwapTile2);
-                pendingSwapTile1 = sf::Vector2i(-1, -1);
-                pendingSwapTile2 = sf::Vector2i(-1, -1);
-            }
-        }
-        else if (t >= 1.0f && selectedTile.x != -1)
-        {
-            scale = targetScale;
-        }
-        
-        if (scalingTile.x != -1)
-        {
-            float tileSize = getTileSize();
-            float padding = getPadding();
-            float shapeSize = tileSize - padding * 2;
-            float scaledSize = shapeSize * scale;
-            float offset = (scaledSize - shapeSize) / 2.0f;
-            
-            RoundedRectangle scaledShape = shapes[scalingTile.y][scalingTile.x];
-            scaledShape.setSize(sf::Vector2f(scaledSize, scaledSize));
-            scaledShape.setPosition(sf::Vector2f(scalingTile.x * tileSize + padding - offset, 
-                                                  scalingTile.y * tileSize + padding - offset));
-            
-            window.draw(scaledShape);
-        }
+        boardRenderer.addTile(tiles[scalingTile.y][scalingTile.x].colorIndex, getTilePosition(scalingTile.y, scalingTile.x), scale);
     }
     else if (selectedTile.x != -1 && selectedTile.y != -1 && gameState == GameState::Idle)
     {
-        float tileSize = getTileSize();
-        float padding = getPadding();
-        float scale = 1.18f;
-        
-        float shapeSize = tileSize - padding * 2;
-        float scaledSize = shapeSize * scale;
-        float offset = (scaledSize - shapeSize) / 2.0f;
-        
-        RoundedRectangle scaledShape = shapes[selectedTile.y][selectedTile.x];
-        scaledShape.setSize(sf::Vector2f(scaledSize, scaledSize));
-        scaledShape.setPosition(sf::Vector2f(selectedTile.x * tileSize + padding - offset, 
-                                              selectedTile.y * tileSize + padding - offset));
-        
-        window.draw(scaledShape);
+        boardRenderer.addTile(tiles[selectedTile.y][selectedTile.x].colorIndex, getTilePosition(selectedTile.y, selectedTile.x), 1.18f);
     }
 }
 
 void GameBoard::drawGrid(sf::RenderWindow &window)
 {
-    if (!gameLogic)
-    {
-        return;
-    }
-
-    int width = gameLogic->getWidth();
-    int height = gameLogic->getHeight();
+    int width = boardWidth;
+    int height = boardHeight;
     float tileSize = getTileSize();
 
-    sf::RectangleShape line;
-    line.setFillColor(sf::Color(180, 180, 180, 200));
-
-    for (int i = 0; i <= height; i++)
-    {
-        line.setSize(sf::Vector2f(width * tileSize, 2.f));
-        line.setPosition(sf::Vector2f(0.f, i * tileSize));
-        window.draw(line);
-    }
-
-    for (int i = 0; i <= width; i++)
+    if (!background.isBuiltFor(width, height, tileSize))
     {
-        line.setSize(sf::Vector2f(2.f, height * tileSize));
-        line.setPosition(sf::Vector2f(i * tileSize, 0.f));
-        window.draw(line);
+        background.build(width, height, tileSize);
     }
+    background.draw(window);
 }
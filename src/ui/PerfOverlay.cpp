@@ -0,0 +1,125 @@
+#include "ui/PerfOverlay.h"
+#include "utils/PerfStats.h"
+#include "utils/RenderStats.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+static const char *const fontPaths[] = {
+    "C:/Windows/Fonts/consola.ttf",
+    "C:/Windows/Fonts/arial.ttf",
+    "/System/Library/Fonts/Menlo.ttc",
+    "/System/Library/Fonts/Supplemental/Arial.ttf",
+    "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf",
+    "/usr/share/fonts/TTF/DejaVuSansMono.ttf",
+    "/usr/share/fonts/dejavu/DejaVuSansMono.ttf",
+    "/usr/share/fonts/truetype/liberation/LiberationMono-Regular.ttf"};
+
+static const char *const phaseNames[] = {"events", "update", "render", "display"};
+
+static const sf::Color phaseColors[] = {sf::Color(90, 160, 255), sf::Color(120, 220, 120), sf::Color(255, 190, 70),
+                                        sf::Color(200, 120, 230)};
+
+static const float graphWidth = 240.f;
+static const float graphHeight = 60.f;
+static const float graphScaleMs = 33.3f;
+static const float padding = 8.f;
+
+PerfOverlay::PerfOverlay()
+{
+    for (const char *path : fontPaths)
+    {
+        if (font.openFromFile(path))
+        {
+            hasFont = true;
+            break;
+        }
+    }
+}
+
+void PerfOverlay::draw(sf::RenderTarget &target)
+{
+    if (!visible)
+    {
+        return;
+    }
+
+    const PerfStats &stats = PerfStats::getInstance();
+    float panelHeight = graphHeight + 14.f + (hasFont ? 110.f : 0.f) + padding * 2;
+
+    vertices.clear();
+    addRect(sf::Vector2f(0.f, 0.f), sf::Vector2f(graphWidth + padding * 2, panelHeight), sf::Color(0, 0, 0, 170));
+
+    sf::Vector2f graph(padding, padding);
+    float barWidth = graphWidth / PerfStats::historySize;
+    for (int i = 0; i < stats.getRecordedFrames(); i++)
+    {
+        float ms = stats.getFrameTime(i);
+        float barHeight = std::min(ms / graphScaleMs, 1.f) * graphHeight;
+        sf::Color color = ms > 16.7f ? sf::Color(230, 80, 80) : sf::Color(120, 220, 120);
+        addRect(sf::Vector2f(graph.x + graphWidth - (i + 1) * barWidth, graph.y + graphHeight - barHeight),
+                sf::Vector2f(barWidth, barHeight), color);
+    }
+    addRect(sf::Vector2f(graph.x, graph.y + graphHeight * (1.f - 16.7f / graphScaleMs)), sf::Vector2f(graphWidth, 1.f),
+            sf::Color(255, 255, 255, 120));
+
+    float x = graph.x;
+    float barY = graph.y + graphHeight + 4.f;
+    for (int p = 0; p < PerfStats::phaseCount; p++)
+    {
+        float width = std::min(stats.getPhasePercentile(static_cast<PerfPhase>(p), 0.5f) / graphScaleMs, 1.f) * graphWidth;
+        addRect(sf::Vector2f(x, barY), sf::Vector2f(width, 10.f), phaseColors[p]);
+        x += width;
+    }
+
+    target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+
+    if (hasFont)
+    {
+        drawText(target, sf::Vector2f(padding, barY + 14.f));
+    }
+}
+
+void PerfOverlay::drawText(sf::RenderTarget &target, const sf::Vector2f &position)
+{
+    const PerfStats &stats = PerfStats::getInstance();
+    const RenderStats &renderStats = RenderStats::getInstance();
+    char line[96];
+
+    std::snprintf(line, sizeof(line), "frame p50 %.2f  p95 %.2f  p99 %.2f ms\n", stats.getFramePercentile(0.5f),
+                  stats.getFramePercentile(0.95f), stats.getFramePercentile(0.99f));
+    std::string text = line;
+
+    for (int p = 0; p < PerfStats::phaseCount; p++)
+    {
+        PerfPhase phase = static_cast<PerfPhase>(p);
+        std::snprintf(line, sizeof(line), "%-8s p50 %.2f  p95 %.2f ms\n", phaseNames[p],
+                      stats.getPhasePercentile(phase, 0.5f), stats.getPhasePercentile(phase, 0.95f));
+        text += line;
+    }
+
+    std::snprintf(line, sizeof(line), "draws %d  vertices %zu\nanimations %d  state %s", renderStats.getDrawCalls(),
+                  renderStats.getVertexCount(), stats.getActiveAnimations(),
+                  stats.getGameState() ? stats.getGameState() : "-");
+    text += line;
+
+    sf::Text label(font, text, 12);
+    label.setFillColor(sf::Color::White);
+    label.setPosition(position);
+    target.draw(label);
+}
+
+void PerfOverlay::addRect(const sf::Vector2f &position, const sf::Vector2f &size, const sf::Color &color)
+{
+    sf::Vertex topLeft{position, color};
+    sf::Vertex topRight{position + sf::Vector2f(size.x, 0.f), color};
+    sf::Vertex bottomLeft{position + sf::Vector2f(0.f, size.y), color};
+    sf::Vertex bottomRight{position + size, color};
+
+    vertices.push_back(topLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomRight);
+    vertices.push_back(topLeft);
+    vertices.push_back(bottomRight);
+    vertices.push_back(bottomLeft);
+}
@@ -3,14 +3,14 @@
 #include "utils/ColorManager.h"
 #include "utils/GameConfig.h"
 #include <algorithm>
-#include <random>
 
 SettingsScene::SettingsScene(float windowWidth, float windowHeight)
     : windowWidth(windowWidth),
       windowHeight(windowHeight),
       isSelectingGrid(false),
       numColors(6),
-      gridSize(8, 8)
+      gridSize(8, 8),
+      rng(Rng::generateSeed())
 {
     availableColors = ColorManager::getAllColors();
     selectedColorIndices = {0, 1, 2, 3, 4, 5};
@@ -180,9 +180,6 @@ void SettingsScene::renderGridSelector(sf::RenderWindow &window)
 
 void SettingsScene::generateGridColors()
 {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    
     for (int i = 0; i < maxGridSize; i++)
     {
         for (int j = 0; j < maxGridSize; j++)
@@ -193,8 +190,7 @@ void SettingsScene::generateGridColors()
             }
             else
             {
-                std::uniform_int_distribution<> dis(0, selectedColorIndices.size() - 1);
-                int randomIdx = dis(gen);
+                int randomIdx = rng.nextBelow(selectedColorIndices.size());
                 int colorIdx = selectedColorIndices[randomIdx];
                 gridCellColors[i][j] = availableColors[colorIdx];
             }
@@ -0,0 +1,67 @@
+#include "ui/TileAtlas.h"
+#include "utils/ColorManager.h"
+#include "utils/RoundedRectangle.h"
+#include <algorithm>
+#include <cmath>
+
+bool TileAtlas::build(float newShapeSize, float newCornerRadius, float newSelectedScale)
+{
+    const std::vector<sf::Color> &colors = ColorManager::getAllColors();
+
+    if (valid && newShapeSize == shapeSize && newCornerRadius == cornerRadius && newSelectedScale == selectedScale &&
+        static_cast<int>(colors.size()) == colorCount)
+    {
+        return true;
+    }
+
+    shapeSize = newShapeSize;
+    cornerRadius = newCornerRadius;
+    selectedScale = newSelectedScale;
+    colorCount = static_cast<int>(colors.size());
+
+    cellSize = std::ceil(shapeSize * std::max(1.f, selectedScale)) + 2.f;
+    unsigned int cell = static_cast<unsigned int>(cellSize);
+
+    sf::ContextSettings settings;
+    settings.antiAliasingLevel = std::min(4u, sf::RenderTexture::getMaximumAntiAliasingLevel());
+
+    valid = colorCount > 0 && texture.resize(sf::Vector2u(cell * colorCount, cell * 2), settings);
+    if (!valid)
+    {
+        return false;
+    }
+
+    texture.clear(sf::Color::Transparent);
+
+    sf::RectangleShape background(sf::Vector2f(cellSize, cellSize));
+    RoundedRectangle shape;
+
+    for (int c = 0; c < colorCount; c++)
+    {
+        for (int variant = 0; variant < 2; variant++)
+        {
+            sf::Vector2f cellOrigin(c * cellSize, variant * cellSize);
+            float scale = variant ? selectedScale : 1.f;
+            float size = shapeSize * scale;
+
+            background.setPosition(cellOrigin);
+            background.setFillColor(sf::Color(colors[c].r, colors[c].g, colors[c].b, 0));
+            texture.draw(background, sf::BlendNone);
+
+            shape.setSize(sf::Vector2f(size, size));
+            shape.setCornerRadius(cornerRadius * scale);
+            shape.setFillColor(colors[c]);
+            shape.setPosition(cellOrigin + sf::Vector2f((cellSize - size) / 2.f, (cellSize - size) / 2.f));
+            texture.draw(shape);
+        }
+    }
+
+    texture.display();
+    texture.setSmooth(true);
+    return true;
+}
+
+sf::FloatRect TileAtlas::getTextureRect(int colorIndex, bool selected) const
+{
+    return sf::FloatRect(sf::Vector2f(colorIndex * cellSize, selected ? cellSize : 0.f), sf::Vector2f(cellSize, cellSize));
+}
@@ -35,6 +35,8 @@ sf::Keyboard::Key KeyboardMonitor::toSFMLKey(GlobalKey key) const
         return sf::Keyboard::Key::Space;
     case GlobalKey::Enter:
         return sf::Keyboard::Key::Enter;
+    case GlobalKey::F3:
+        return sf::Keyboard::Key::F3;
     default:
         return sf::Keyboard::Key::Unknown;
     }
@@ -0,0 +1,68 @@
+#include "utils/PerfStats.h"
+#include <algorithm>
+
+PerfStats &PerfStats::getInstance()
+{
+    static PerfStats instance;
+    return instance;
+}
+
+void PerfStats::beginFrame()
+{
+    std::fill(currentPhases, currentPhases + phaseCount, 0.f);
+    activeAnimations = 0;
+    gameState = nullptr;
+}
+
+void PerfStats::endFrame()
+{
+    float frame = 0.f;
+    for (int p = 0; p < phaseCount; p++)
+    {
+        phaseHistory[p][nextFrame] = currentPhases[p];
+        frame += currentPhases[p];
+    }
+    frameHistory[nextFrame] = frame;
+
+    nextFrame = (nextFrame + 1) % historySize;
+    recordedFrames = std::min(recordedFrames + 1, historySize);
+}
+
+void PerfStats::addPhaseTime(PerfPhase phase, float milliseconds)
+{
+    currentPhases[static_cast<int>(phase)] += milliseconds;
+}
+
+float PerfStats::getFramePercentile(float p) const
+{
+    return percentile(frameHistory, p);
+}
+
+float PerfStats::getPhasePercentile(PerfPhase phase, float p) const
+{
+    return percentile(phaseHistory[static_cast<int>(phase)], p);
+}
+
+float PerfStats::getFrameTime(int framesAgo) const
+{
+    if (framesAgo < 0 || framesAgo >= recordedFrames)
+    {
+        return 0.f;
+    }
+    return frameHistory[(nextFrame - 1 - framesAgo + historySize) % historySize];
+}
+
+float PerfStats::percentile(const float *history, float p) const
+{
+    if (recordedFrames == 0)
+    {
+        return 0.f;
+    }
+
+    float samples[historySize];
+    std::copy(history, history + recordedFrames, samples);
+
+    int index = std::min(recordedFrames - 1, static_cast<int>(p * (recordedFrames - 1) + 0.5f));
+    std::nth_element(samples, samples + index, samples + recordedFrames);
+    return samples[index];
+}
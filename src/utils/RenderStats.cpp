@@ -0,0 +1,7 @@
+#include "utils/RenderStats.h"
+
+RenderStats &RenderStats::getInstance()
+{
+    static RenderStats instance;
+    return instance;
+}
@@ -1,38 +1,43 @@
 #include "utils/RoundedRectangle.h"
+#include "utils/RenderStats.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+static const int cornerSegments = 8;
 
 RoundedRectangle::RoundedRectangle(const sf::Vector2f &size, float cornerRadius)
-    : size(size), position(0.f, 0.f), fillColor(sf::Color::White), cornerRadius(cornerRadius)
+    : size(size), fillColor(sf::Color::White), cornerRadius(cornerRadius), vertices(sf::PrimitiveType::TriangleFan)
 {
-    updateShapes();
+    updateGeometry();
 }
 
 void RoundedRectangle::setSize(const sf::Vector2f &newSize)
 {
-    size = newSize;
-    updateShapes();
-}
-
-void RoundedRectangle::setPosition(const sf::Vector2f &newPosition)
-{
-    position = newPosition;
-    updateShapes();
+    if (newSize != size)
+    {
+        size = newSize;
+        updateGeometry();
+    }
 }
 
 void RoundedRectangle::setFillColor(const sf::Color &color)
 {
-    fillColor = color;
-    centerH.setFillColor(color);
-    centerV.setFillColor(color);
-    for (int i = 0; i < 4; i++)
+    if (color != fillColor)
     {
-        corners[i].setFillColor(color);
+        fillColor = color;
+        updateColors();
     }
 }
 
 void RoundedRectangle::setCornerRadius(float radius)
 {
-    cornerRadius = radius;
-    updateShapes();
+    if (radius != cornerRadius)
+    {
+        cornerRadius = radius;
+        updateGeometry();
+    }
 }
 
 sf::Vector2f RoundedRectangle::getSize() const
@@ -40,11 +45,6 @@ sf::Vector2f RoundedRectangle::getSize() const
     return size;
 }
 
-sf::Vector2f RoundedRectangle::getPosition() const
-{
-    return position;
-}
-
 sf::Color RoundedRectangle::getFillColor() const
 {
     return fillColor;
@@ -57,39 +57,70 @@ float RoundedRectangle::getCornerRadius() const
 
 sf::FloatRect RoundedRectangle::getGlobalBounds() const
 {
-    return sf::FloatRect(position, size);
+    return getTransform().transformRect(sf::FloatRect(sf::Vector2f(0.f, 0.f), size));
 }
 
-void RoundedRectangle::updateShapes()
+std::shared_ptr<const RoundedRectangle::Outline> RoundedRectangle::getSharedOutline(const sf::Vector2f &size, float cornerRadius)
 {
-    float effectiveRadius = std::min(cornerRadius, std::min(size.x, size.y) / 2.f);
+    static std::map<std::tuple<float, float, float>, std::shared_ptr<const Outline>> cache;
+
+    auto key = std::make_tuple(size.x, size.y, cornerRadius);
+    auto it = cache.find(key);
+    if (it != cache.end())
+    {
+        return it->second;
+    }
 
-    centerH.setSize(sf::Vector2f(size.x - effectiveRadius * 2, size.y));
-    centerH.setPosition(sf::Vector2f(position.x + effectiveRadius, position.y));
-    centerH.setFillColor(fillColor);
+    float radius = std::max(0.f, std::min(cornerRadius, std::min(size.x, size.y) / 2.f));
+    const sf::Vector2f centers[4] = {
+        sf::Vector2f(size.x - radius, size.y - radius),
+        sf::Vector2f(radius, size.y - radius),
+        sf::Vector2f(radius, radius),
+        sf::Vector2f(size.x - radius, radius)};
 
-    centerV.setSize(sf::Vector2f(size.x, size.y - effectiveRadius * 2));
-    centerV.setPosition(sf::Vector2f(position.x, position.y + effectiveRadius));
-    centerV.setFillColor(fillColor);
+    auto points = std::make_shared<Outline>();
+    points->reserve(4 * (cornerSegments + 1));
 
-    for (int i = 0; i < 4; i++)
+    const float quarterTurn = 3.14159265f / 2.f;
+    for (int corner = 0; corner < 4; corner++)
     {
-        corners[i].setRadius(effectiveRadius);
-        corners[i].setFillColor(fillColor);
+        for (int k = 0; k <= cornerSegments; k++)
+        {
+            float angle = quarterTurn * (corner + static_cast<float>(k) / cornerSegments);
+            points->push_back(centers[corner] + sf::Vector2f(std::cos(angle), std::sin(angle)) * radius);
+        }
     }
 
-    corners[0].setPosition(sf::Vector2f(position.x, position.y));
-    corners[1].setPosition(sf::Vector2f(position.x + size.x - effectiveRadius * 2, position.y));
-    corners[2].setPosition(sf::Vector2f(position.x, position.y + size.y - effectiveRadius * 2));
-    corners[3].setPosition(sf::Vector2f(position.x + size.x - effectiveRadius * 2, position.y + size.y - effectiveRadius * 2));
+    cache.emplace(key, points);
+    return points;
 }
 
-void RoundedRectangle::draw(sf::RenderTarget &target, sf::RenderStates states) const
+void RoundedRectangle::updateGeometry()
 {
-    target.draw(centerH, states);
-    target.draw(centerV, states);
-    for (int i = 0; i < 4; i++)
+    outline = getSharedOutline(size, cornerRadius);
+
+    vertices.resize(outline->size() + 2);
+    vertices[0].position = size / 2.f;
+    for (std::size_t i = 0; i < outline->size(); i++)
     {
-        target.draw(corners[i], states);
+        vertices[i + 1].position = (*outline)[i];
     }
+    vertices[outline->size() + 1].position = outline->front();
+
+    updateColors();
+}
+
+void RoundedRectangle::updateColors()
+{
+    for (std::size_t i = 0; i < vertices.getVertexCount(); i++)
+    {
+        vertices[i].color = fillColor;
+    }
+}
+
+void RoundedRectangle::draw(sf::RenderTarget &target, sf::RenderStates states) const
+{
+    states.transform *= getTransform();
+    target.draw(vertices, states);
+    RenderStats::getInstance().recordDraw(vertices.getVertexCount());
 }
@@ -0,0 +1,123 @@
+#include "utils/TweenSystem.h"
+#include <algorithm>
+
+void TweenSystem::add(int entity, const sf::Vector2f &start, const sf::Vector2f &target, float startTime, float duration,
+                      Easing easing)
+{
+    if (entity >= static_cast<int>(slots.size()))
+    {
+        slots.resize(entity + 1, -1);
+    }
+
+    int slot = slots[entity];
+    if (slot < 0)
+    {
+        slot = static_cast<int>(entities.size());
+        slots[entity] = slot;
+
+        entities.push_back(entity);
+        startX.push_back(0.f);
+        startY.push_back(0.f);
+        targetX.push_back(0.f);
+        targetY.push_back(0.f);
+        startTimes.push_back(0.f);
+        durations.push_back(0.f);
+        quadratic.push_back(0);
+    }
+
+    startX[slot] = start.x;
+    startY[slot] = start.y;
+    targetX[slot] = target.x;
+    targetY[slot] = target.y;
+    startTimes[slot] = startTime;
+    durations[slot] = std::max(duration, 1e-6f);
+    quadratic[slot] = easing == Easing::EaseInQuad ? 1 : 0;
+}
+
+void TweenSystem::clear()
+{
+    for (int entity : entities)
+    {
+        slots[entity] = -1;
+    }
+
+    entities.clear();
+    startX.clear();
+    startY.clear();
+    targetX.clear();
+    targetY.clear();
+    startTimes.clear();
+    durations.clear();
+    quadratic.clear();
+}
+
+bool TweenSystem::isActive(int entity) const
+{
+    return entity >= 0 && entity < static_cast<int>(slots.size()) && slots[entity] >= 0;
+}
+
+void TweenSystem::interpolate(float now)
+{
+    std::size_t count = entities.size();
+    currentX.resize(count);
+    currentY.resize(count);
+    finished.resize(count);
+
+    const float *sx = startX.data();
+    const float *sy = startY.data();
+    const float *tx = targetX.data();
+    const float *ty = targetY.data();
+    const float *begin = startTimes.data();
+    const float *length = durations.data();
+    const uint8_t *quad = quadratic.data();
+    float *x = currentX.data();
+    float *y = currentY.data();
+    uint8_t *done = finished.data();
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        float t = (now - begin[k]) / length[k];
+        t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+        float eased = quad[k] ? t * t : t;
+
+        x[k] = sx[k] + (tx[k] - sx[k]) * eased;
+        y[k] = sy[k] + (ty[k] - sy[k]) * eased;
+        done[k] = t >= 1.f;
+    }
+}
+
+void TweenSystem::retireFinished()
+{
+    std::size_t kept = 0;
+    for (std::size_t k = 0; k < entities.size(); k++)
+    {
+        if (finished[k])
+        {
+            slots[entities[k]] = -1;
+            continue;
+        }
+
+        if (kept != k)
+        {
+            entities[kept] = entities[k];
+            startX[kept] = startX[k];
+            startY[kept] = startY[k];
+            targetX[kept] = targetX[k];
+            targetY[kept] = targetY[k];
+            startTimes[kept] = startTimes[k];
+            durations[kept] = durations[k];
+            quadratic[kept] = quadratic[k];
+            slots[entities[kept]] = static_cast<int>(kept);
+        }
+        kept++;
+    }
+
+    entities.resize(kept);
+    startX.resize(kept);
+    startY.resize(kept);
+    targetX.resize(kept);
+    targetY.resize(kept);
+    startTimes.resize(kept);
+    durations.resize(kept);
+    quadratic.resize(kept);
+}
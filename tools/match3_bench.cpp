@@ -0,0 +1,424 @@
+#include "core/GameLogic.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+static long long allocationCount = 0;
+
+void *operator new(std::size_t size)
+{
+    allocationCount++;
+    void *p = std::malloc(size ? size : 1);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+enum class BenchOp
+{
+    Initialize,
+    FindMatches,
+    ClearMatches,
+    ApplyGravity,
+    ApplyGravityReference,
+    FillEmptySpaces,
+    FillEmptySpacesReference,
+    SwapTiles,
+    ResolveCascade
+};
+
+static const BenchOp allOps[] = {BenchOp::Initialize, BenchOp::FindMatches, BenchOp::ClearMatches,
+                                 BenchOp::ApplyGravity, BenchOp::ApplyGravityReference, BenchOp::FillEmptySpaces,
+                                 BenchOp::FillEmptySpacesReference, BenchOp::SwapTiles, BenchOp::ResolveCascade};
+
+struct BenchOptions
+{
+    int minSize = 3;
+    int maxSize = 32;
+    // 0 benchmarks square boards; otherwise every board has this height.
+    int height = 0;
+    std::vector<int> colorCounts = {4, 5, 6};
+    std::vector<MatchKernel> kernels = {MatchKernel::Auto};
+    int samples = 2000;
+    uint64_t seed = 1;
+    bool hash = false;
+    std::string output;
+};
+
+struct BenchResult
+{
+    double meanNs;
+    double minNs;
+    double p50Ns;
+    double p90Ns;
+    double p99Ns;
+    double allocsPerOp;
+};
+
+static const char *opName(BenchOp op)
+{
+    switch (op)
+    {
+    case BenchOp::Initialize:
+        return "initialize";
+    case BenchOp::FindMatches:
+        return "findMatches";
+    case BenchOp::ClearMatches:
+        return "clearMatches";
+    case BenchOp::ApplyGravity:
+        return "applyGravity";
+    case BenchOp::ApplyGravityReference:
+        return "applyGravityReference";
+    case BenchOp::FillEmptySpaces:
+        return "fillEmptySpaces";
+    case BenchOp::FillEmptySpacesReference:
+        return "fillEmptySpacesReference";
+    case BenchOp::SwapTiles:
+        return "swapTiles";
+    default:
+        return "resolveCascade";
+    }
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Brings the board into the state the measured operation expects. Nothing
+// here is timed or counted. Generated boards are match-free, so the ops
+// that need matches start from a uniformly random board, redrawn until it
+// has at least one match; small boards often have none.
+static void prepare(GameLogic &logic, BenchOp op, MatchResult &result)
+{
+    if (op == BenchOp::Initialize || op == BenchOp::SwapTiles)
+    {
+        logic.initialize();
+        return;
+    }
+
+    do
+    {
+        logic.randomize();
+    } while (!logic.findMatches(result));
+
+    if (op == BenchOp::FindMatches || op == BenchOp::ResolveCascade || op == BenchOp::ClearMatches)
+    {
+        return;
+    }
+
+    logic.clearMatches(result);
+    if (op == BenchOp::FillEmptySpaces || op == BenchOp::FillEmptySpacesReference)
+    {
+        logic.applyGravity();
+    }
+}
+
+static BenchResult runBench(GameLogic &logic, BenchOp op, int samples)
+{
+    MatchResult result;
+    CascadeTrace trace;
+    std::vector<double> times(samples);
+    long long allocations = 0;
+
+    prepare(logic, op, result);
+    logic.resolveCascade(trace);
+
+    for (int s = 0; s < samples; s++)
+    {
+        prepare(logic, op, result);
+
+        int row = static_cast<int>(logic.getRng().nextBelow(static_cast<uint32_t>(logic.getHeight())));
+        int col = static_cast<int>(logic.getRng().nextBelow(static_cast<uint32_t>(logic.getWidth() - 1)));
+
+        long long allocationsBefore = allocationCount;
+        auto start = std::chrono::steady_clock::now();
+        switch (op)
+        {
+        case BenchOp::Initialize:
+            logic.initialize();
+            break;
+        case BenchOp::FindMatches:
+            logic.findMatches(result);
+            break;
+        case BenchOp::ClearMatches:
+            logic.clearMatches(result);
+            break;
+        case BenchOp::ApplyGravity:
+            logic.applyGravity();
+            break;
+        case BenchOp::ApplyGravityReference:
+            logic.applyGravityReference();
+            break;
+        case BenchOp::FillEmptySpaces:
+            logic.fillEmptySpaces();
+            break;
+        case BenchOp::FillEmptySpacesReference:
+            logic.fillEmptySpacesReference();
+            break;
+        case BenchOp::SwapTiles:
+            logic.swapTiles(row, col, row, col + 1);
+            break;
+        case BenchOp::ResolveCascade:
+            logic.resolveCascade(trace);
+            break;
+        }
+        auto end = std::chrono::steady_clock::now();
+        allocations += allocationCount - allocationsBefore;
+
+        times[s] = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    double total = 0;
+    for (double t : times)
+    {
+        total += t;
+    }
+    std::sort(times.begin(), times.end());
+
+    BenchResult bench;
+    bench.meanNs = total / samples;
+    bench.minNs = times.front();
+    bench.p50Ns = percentile(times, 0.50);
+    bench.p90Ns = percentile(times, 0.90);
+    bench.p99Ns = percentile(times, 0.99);
+    bench.allocsPerOp = static_cast<double>(allocations) / samples;
+    return bench;
+}
+
+static bool parseKernel(const std::string &name, std::vector<MatchKernel> &kernels)
+{
+    static const MatchKernel known[] = {MatchKernel::Bitboard, MatchKernel::Scalar, MatchKernel::SSE2,
+                                        MatchKernel::AVX2, MatchKernel::AVX512};
+
+    if (name == "all")
+    {
+        for (MatchKernel kernel : known)
+        {
+            if (MatchKernels::isSupported(kernel))
+            {
+                kernels.push_back(kernel);
+            }
+        }
+        return true;
+    }
+    if (name == "auto")
+    {
+        kernels.push_back(MatchKernel::Auto);
+        return true;
+    }
+    for (MatchKernel kernel : known)
+    {
+        if (name == MatchKernels::getName(kernel))
+        {
+            if (!MatchKernels::isSupported(kernel))
+            {
+                std::fprintf(stderr, "kernel %s is not supported on this CPU\n", name.c_str());
+                return false;
+            }
+            kernels.push_back(kernel);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parseList(const char *value, std::vector<std::string> &items)
+{
+    items.clear();
+    std::string current;
+    for (const char *p = value;; p++)
+    {
+        if (*p == ',' || *p == '\0')
+        {
+            if (current.empty())
+            {
+                return false;
+            }
+            items.push_back(current);
+            current.clear();
+            if (*p == '\0')
+            {
+                return true;
+            }
+        }
+        else
+        {
+            current += *p;
+        }
+    }
+}
+
+static void printUsage()
+{
+    std::printf("usage: match3_bench [--min-size N] [--max-size N] [--height N] [--colors 4,5,6] [--samples N]\n"
+                "                    [--kernels auto|all|bitboard,scalar,sse2,avx2,avx512] [--hash 0|1] [--seed N]\n"
+                "                    [--out FILE]\n");
+}
+
+static bool parseOptions(int argc, char **argv, BenchOptions &options)
+{
+    std::vector<std::string> items;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+
+        const char *value = argv[++i];
+        if (arg == "--min-size")
+        {
+            options.minSize = std::atoi(value);
+        }
+        else if (arg == "--max-size")
+        {
+            options.maxSize = std::atoi(value);
+        }
+        else if (arg == "--height")
+        {
+            options.height = std::atoi(value);
+        }
+        else if (arg == "--samples")
+        {
+            options.samples = std::atoi(value);
+        }
+        else if (arg == "--seed")
+        {
+            options.seed = std::strtoull(value, nullptr, 10);
+        }
+        else if (arg == "--hash")
+        {
+            options.hash = std::atoi(value) != 0;
+        }
+        else if (arg == "--out")
+        {
+            options.output = value;
+        }
+        else if (arg == "--colors")
+        {
+            if (!parseList(value, items))
+            {
+                return false;
+            }
+            options.colorCounts.clear();
+            for (const auto &item : items)
+            {
+                options.colorCounts.push_back(std::atoi(item.c_str()));
+            }
+        }
+        else if (arg == "--kernels")
+        {
+            if (!parseList(value, items))
+            {
+                return false;
+            }
+            options.kernels.clear();
+            for (const auto &item : items)
+            {
+                if (!parseKernel(item, options.kernels))
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    for (int colors : options.colorCounts)
+    {
+        if (colors < 2 || colors > 255)
+        {
+            return false;
+        }
+    }
+    return options.minSize >= 3 && options.maxSize >= options.minSize && options.samples > 0 &&
+           (options.height == 0 || options.height >= 3) &&
+           !options.kernels.empty();
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (!options.output.empty())
+    {
+        out = std::fopen(options.output.c_str(), "w");
+        if (!out)
+        {
+            std::fprintf(stderr, "failed to open %s\n", options.output.c_str());
+            return 1;
+        }
+    }
+
+    std::fprintf(out, "{\n  \"samples\": %d,\n  \"seed\": %llu,\n  \"hash\": %s,\n  \"results\": [\n",
+                 options.samples, static_cast<unsigned long long>(options.seed), options.hash ? "true" : "false");
+
+    bool first = true;
+    for (MatchKernel kernel : options.kernels)
+    {
+        GameLogic::setMatchKernel(kernel);
+        const char *kernelName = MatchKernels::getName(kernel);
+
+        for (int colors : options.colorCounts)
+        {
+            for (int size = options.minSize; size <= options.maxSize; size++)
+            {
+                int height = options.height > 0 ? options.height : size;
+                GameLogic logic(size, height, colors);
+                logic.setHashing(options.hash);
+
+                for (BenchOp op : allOps)
+                {
+                    logic.seed(options.seed);
+                    BenchResult bench = runBench(logic, op, options.samples);
+
+                    std::fprintf(out,
+                                 "%s    {\"kernel\": \"%s\", \"engine\": \"%s\", \"op\": \"%s\", \"width\": %d, "
+                                 "\"height\": %d, \"colors\": %d, \"ns_per_op\": %.1f, \"min_ns\": %.1f, "
+                                 "\"p50_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, \"allocs_per_op\": %.3f}",
+                                 first ? "" : ",\n", kernelName, logic.getMatchEngineName().c_str(),
+                                 opName(op), size, height, colors, bench.meanNs,
+                                 bench.minNs, bench.p50Ns, bench.p90Ns, bench.p99Ns, bench.allocsPerOp);
+                    first = false;
+                }
+            }
+        }
+    }
+
+    std::fprintf(out, "\n  ]\n}\n");
+    if (out != stdout)
+    {
+        std::fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,333 @@
+#include "core/GameLogic.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class BotPolicy
+{
+    Random,
+    Greedy,
+    First
+};
+
+struct SimOptions
+{
+    int width = 8;
+    int height = 8;
+    int numColors = 6;
+    int movesPerGame = 50;
+    long long games = 100000;
+    int threads = 0;
+    uint64_t seed = 1;
+    BotPolicy policy = BotPolicy::Random;
+    std::string output = "match3_sim.csv";
+};
+
+static const int maxCascade = 64;
+
+struct SimStats
+{
+    long long games = 0;
+    long long moves = 0;
+    long long deadBoards = 0;
+    long long failedReshuffles = 0;
+    long long endedEarly = 0;
+    long long deadBoardGames = 0;
+    long long movesToFirstDead = 0;
+    long long clearedTiles = 0;
+    std::vector<long long> cascadeHistogram = std::vector<long long>(maxCascade + 1, 0);
+
+    void merge(const SimStats &other)
+    {
+        games += other.games;
+        moves += other.moves;
+        deadBoards += other.deadBoards;
+        failedReshuffles += other.failedReshuffles;
+        endedEarly += other.endedEarly;
+        deadBoardGames += other.deadBoardGames;
+        movesToFirstDead += other.movesToFirstDead;
+        clearedTiles += other.clearedTiles;
+        for (int i = 0; i <= maxCascade; i++)
+        {
+            cascadeHistogram[i] += other.cascadeHistogram[i];
+        }
+    }
+};
+
+static uint64_t gameSeed(uint64_t baseSeed, long long game)
+{
+    uint64_t z = baseSeed + 0x9E3779B97F4A7C15ull * static_cast<uint64_t>(game + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static const char *policyName(BotPolicy policy)
+{
+    switch (policy)
+    {
+    case BotPolicy::Greedy:
+        return "greedy";
+    case BotPolicy::First:
+        return "first";
+    default:
+        return "random";
+    }
+}
+
+static const Move &chooseMove(GameLogic &logic, const std::vector<Move> &moves, BotPolicy policy)
+{
+    if (policy == BotPolicy::First)
+    {
+        return moves.front();
+    }
+
+    if (policy == BotPolicy::Greedy)
+    {
+        size_t best = 0;
+        int bestScore = -1;
+        for (size_t i = 0; i < moves.size(); i++)
+        {
+            const Move &move = moves[i];
+            int score = logic.scoreSwap(move.row1, move.col1, move.row2, move.col2);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                best = i;
+            }
+        }
+        return moves[best];
+    }
+
+    return moves[logic.getRng().nextBelow(static_cast<uint32_t>(moves.size()))];
+}
+
+static void runGames(const SimOptions &options, long long firstGame, long long lastGame, SimStats &stats)
+{
+    std::vector<int> colors(options.numColors);
+    for (int i = 0; i < options.numColors; i++)
+    {
+        colors[i] = i;
+    }
+
+    GameLogic logic(options.width, options.height, options.numColors);
+    logic.setAvailableColors(colors);
+
+    CascadeTrace trace;
+    std::vector<Move> moves;
+
+    for (long long game = firstGame; game < lastGame; game++)
+    {
+        logic.seed(gameSeed(options.seed, game));
+        logic.initialize();
+        logic.resolveCascade(trace);
+
+        int turn = 0;
+        bool hitDeadBoard = false;
+        for (; turn < options.movesPerGame; turn++)
+        {
+            logic.findValidMoves(moves);
+            if (moves.empty())
+            {
+                stats.deadBoards++;
+                if (!hitDeadBoard)
+                {
+                    hitDeadBoard = true;
+                    stats.deadBoardGames++;
+                    stats.movesToFirstDead += turn;
+                }
+                if (!logic.reshuffle())
+                {
+                    stats.failedReshuffles++;
+                    break;
+                }
+                logic.findValidMoves(moves);
+                if (moves.empty())
+                {
+                    break;
+                }
+            }
+
+            const Move &move = chooseMove(logic, moves, options.policy);
+            logic.swapTiles(move.row1, move.col1, move.row2, move.col2);
+
+            int steps = logic.resolveCascade(trace);
+            stats.cascadeHistogram[std::min(steps, maxCascade)]++;
+            stats.clearedTiles += static_cast<long long>(trace.getCleared().size());
+            stats.moves++;
+        }
+
+        if (turn < options.movesPerGame)
+        {
+            stats.endedEarly++;
+        }
+        stats.games++;
+    }
+}
+
+static double averageMovesToFirstDead(const SimStats &stats)
+{
+    return stats.deadBoardGames ? static_cast<double>(stats.movesToFirstDead) / stats.deadBoardGames : 0.0;
+}
+
+static bool writeCsv(const SimOptions &options, const SimStats &stats, double seconds)
+{
+    FILE *file = std::fopen(options.output.c_str(), "w");
+    if (!file)
+    {
+        return false;
+    }
+
+    std::fprintf(file, "width,height,colors,policy,moves_per_game,threads,games,moves,dead_boards,failed_reshuffles,ended_early,dead_board_games,avg_moves_to_first_dead,cleared_tiles,seconds,games_per_second\n");
+    std::fprintf(file, "%d,%d,%d,%s,%d,%d,%lld,%lld,%lld,%lld,%lld,%lld,%.2f,%lld,%.6f,%.1f\n",
+                 options.width, options.height, options.numColors, policyName(options.policy),
+                 options.movesPerGame, options.threads, stats.games, stats.moves, stats.deadBoards,
+                 stats.failedReshuffles, stats.endedEarly, stats.deadBoardGames, averageMovesToFirstDead(stats),
+                 stats.clearedTiles, seconds, stats.games / seconds);
+    std::fprintf(file, "\ncascade_length,count\n");
+    for (int i = 0; i <= maxCascade; i++)
+    {
+        if (stats.cascadeHistogram[i] != 0)
+        {
+            std::fprintf(file, "%d,%lld\n", i, stats.cascadeHistogram[i]);
+        }
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+static void printUsage()
+{
+    std::printf("usage: match3_sim [--games N] [--threads N] [--width N] [--height N] [--colors N]\n"
+                "                  [--moves N] [--policy random|greedy|first] [--seed N] [--out FILE]\n");
+}
+
+static bool parseOptions(int argc, char **argv, SimOptions &options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+
+        const char *value = argv[++i];
+        if (arg == "--games")
+        {
+            options.games = std::atoll(value);
+        }
+        else if (arg == "--threads")
+        {
+            options.threads = std::atoi(value);
+        }
+        else if (arg == "--width")
+        {
+            options.width = std::atoi(value);
+        }
+        else if (arg == "--height")
+        {
+            options.height = std::atoi(value);
+        }
+        else if (arg == "--colors")
+        {
+            options.numColors = std::atoi(value);
+        }
+        else if (arg == "--moves")
+        {
+            options.movesPerGame = std::atoi(value);
+        }
+        else if (arg == "--seed")
+        {
+            options.seed = std::strtoull(value, nullptr, 10);
+        }
+        else if (arg == "--out")
+        {
+            options.output = value;
+        }
+        else if (arg == "--policy")
+        {
+            if (std::strcmp(value, "random") == 0)
+            {
+                options.policy = BotPolicy::Random;
+            }
+            else if (std::strcmp(value, "greedy") == 0)
+            {
+                options.policy = BotPolicy::Greedy;
+            }
+            else if (std::strcmp(value, "first") == 0)
+            {
+                options.policy = BotPolicy::First;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.width >= 3 && options.height >= 3 && options.numColors >= 2 && options.games > 0;
+}
+
+int main(int argc, char **argv)
+{
+    SimOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    if (options.threads <= 0)
+    {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<SimStats> threadStats(options.threads);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < options.threads; t++)
+    {
+        long long first = options.games * t / options.threads;
+        long long last = options.games * (t + 1) / options.threads;
+        workers.emplace_back(runGames, std::cref(options), first, last, std::ref(threadStats[t]));
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    SimStats total;
+    for (const auto &stats : threadStats)
+    {
+        total.merge(stats);
+    }
+
+    std::printf("%lld games, %lld moves in %.3fs on %d threads (%.0f games/s)\n",
+                total.games, total.moves, seconds, options.threads, total.games / seconds);
+    std::printf("ended early %lld, dead boards %lld (%.4f per move) in %lld games, avg moves to first dead %.2f\n",
+                total.endedEarly, total.deadBoards,
+                total.moves ? static_cast<double>(total.deadBoards) / total.moves : 0.0, total.deadBoardGames,
+                averageMovesToFirstDead(total));
+    std::printf("avg cleared/move %.2f\n", total.moves ? static_cast<double>(total.clearedTiles) / total.moves : 0.0);
+
+    if (!writeCsv(options, total, seconds))
+    {
+        std::fprintf(stderr, "failed to write %s\n", options.output.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "core/GameLogic.h"
+#include "core/ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+static std::atomic<long long> allocationCount(0);
+static std::atomic<long long> liveBytes(0);
+static std::atomic<long long> peakBytes(0);
+
+// Every block carries its size in front so the live and peak heap can be
+// tracked without a sized delete.
+static const std::size_t blockHeader = alignof(std::max_align_t);
+
+void *operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    char *block = static_cast<char *>(std::malloc(size + blockHeader));
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t *>(block) = size;
+
+    long long live = liveBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed) +
+                     static_cast<long long>(size);
+    long long peak = peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+    return block + blockHeader;
+}
+
+void operator delete(void *p) noexcept
+{
+    if (!p)
+    {
+        return;
+    }
+    char *block = static_cast<char *>(p) - blockHeader;
+    liveBytes.fetch_sub(static_cast<long long>(*reinterpret_cast<std::size_t *>(block)), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+struct StressOptions
+{
+    int width = 4096;
+    int height = 4096;
+    int numColors = 6;
+    int threads = 0;
+    int rounds = 5;
+    int maxSteps = 50;
+    uint64_t seed = 1;
+    bool hash = false;
+};
+
+struct PhaseTimes
+{
+    double find = 0;
+    double clear = 0;
+    double gravity = 0;
+    double refill = 0;
+    double cascade = 0;
+};
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void printUsage()
+{
+    std::printf("usage: match3_stress [--width N] [--height N] [--colors N] [--threads N] [--rounds N]\n"
+                "                     [--steps N] [--hash 0|1] [--seed N]\n");
+}
+
+static bool parseOptions(int argc, char **argv, StressOptions &options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+
+        const char *value = argv[++i];
+        if (arg == "--width")
+        {
+            options.width = std::atoi(value);
+        }
+        else if (arg == "--height")
+        {
+            options.height = std::atoi(value);
+        }
+        else if (arg == "--colors")
+        {
+            options.numColors = std::atoi(value);
+        }
+        else if (arg == "--threads")
+        {
+            options.threads = std::atoi(value);
+        }
+        else if (arg == "--rounds")
+        {
+            options.rounds = std::atoi(value);
+        }
+        else if (arg == "--steps")
+        {
+            options.maxSteps = std::atoi(value);
+        }
+        else if (arg == "--hash")
+        {
+            options.hash = std::atoi(value) != 0;
+        }
+        else if (arg == "--seed")
+        {
+            options.seed = std::strtoull(value, nullptr, 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.width >= 3 && options.height >= 3 && options.numColors >= 2 && options.numColors <= 255 &&
+           options.rounds > 0 && options.maxSteps > 0;
+}
+
+// Finding and clearing matches reuses the buffers of the result and the
+// matchers, so once they have grown to fit a board it must not allocate.
+// The boards are replayed from their seeds so the counted pass needs no more
+// room than the warm-up pass. Runs without a pool, on the serial path.
+static long long countSteadyStateAllocations(int width, int height, const StressOptions &options)
+{
+    const int boards = 4;
+    GameLogic logic(width, height, options.numColors);
+    MatchResult result;
+    long long allocations = 0;
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int k = 0; k < boards; k++)
+        {
+            logic.seed(options.seed + k);
+            logic.randomize();
+
+            long long allocationsBefore = allocationCount.load();
+            logic.findMatches(result);
+            logic.clearMatches(result);
+            if (pass == 1)
+            {
+                allocations += allocationCount.load() - allocationsBefore;
+            }
+        }
+    }
+    return allocations;
+}
+
+// Each round fills the board with random colors and resolves the cascade,
+// timing every phase. A step processes every cell once per phase.
+int main(int argc, char **argv)
+{
+    StressOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    ThreadPool pool(options.threads);
+    GameLogic logic(options.width, options.height, options.numColors);
+    logic.setThreadPool(&pool);
+    logic.setHashing(options.hash);
+    logic.seed(options.seed);
+
+    MatchResult result;
+    PhaseTimes times;
+    long long steps = 0;
+    long long clearedCells = 0;
+    long long cascadeSteps = 0;
+
+    for (int round = 0; round < options.rounds; round++)
+    {
+        logic.randomize();
+
+        for (int step = 0; step < options.maxSteps; step++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            bool found = logic.findMatches(result);
+            times.find += secondsSince(start);
+            if (!found)
+            {
+                break;
+            }
+            clearedCells += result.getMask().count();
+
+            start = std::chrono::steady_clock::now();
+            logic.clearMatches(result);
+            times.clear += secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            logic.applyGravity();
+            times.gravity += secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            logic.fillEmptySpaces();
+            times.refill += secondsSince(start);
+
+            steps++;
+        }
+
+        logic.randomize();
+        auto start = std::chrono::steady_clock::now();
+        cascadeSteps += logic.resolveCascade(options.maxSteps);
+        times.cascade += secondsSince(start);
+    }
+
+    double cells = static_cast<double>(options.width) * options.height;
+    double total = times.find + times.clear + times.gravity + times.refill;
+    double bytesPerCell = static_cast<double>(peakBytes.load()) / cells;
+
+    std::printf("%dx%d, %d colors, %d threads, %lld steps, %lld cleared cells\n", options.width, options.height,
+                options.numColors, pool.getThreadCount(), steps, clearedCells);
+    std::printf("find    %8.3fs  %7.1f Mcells/s\n", times.find, cells * steps / times.find / 1e6);
+    std::printf("clear   %8.3fs  %7.1f Mcells/s\n", times.clear, cells * steps / times.clear / 1e6);
+    std::printf("gravity %8.3fs  %7.1f Mcells/s\n", times.gravity, cells * steps / times.gravity / 1e6);
+    std::printf("refill  %8.3fs  %7.1f Mcells/s\n", times.refill, cells * steps / times.refill / 1e6);
+    std::printf("step    %8.3fs  %7.1f Mcells/s\n", total, cells * steps / total / 1e6);
+    std::printf("cascade %8.3fs  %7.1f Mcells/s over %lld untraced steps\n", times.cascade,
+                cells * cascadeSteps / times.cascade / 1e6, cascadeSteps);
+    std::printf("peak heap %.1f MB, %.2f bytes/cell\n", peakBytes.load() / 1e6, bytesPerCell);
+
+    const int checkSizes[][2] = {{8, 8}, {32, 32}, {options.width, options.height}};
+    for (const auto &size : checkSizes)
+    {
+        long long allocations = countSteadyStateAllocations(size[0], size[1], options);
+        if (allocations != 0)
+        {
+            std::fprintf(stderr, "find and clear made %lld allocations after warm-up on %dx%d\n", allocations,
+                         size[0], size[1]);
+            return 1;
+        }
+    }
+
+    if (options.hash && logic.getHash() != logic.getBoard().computeHash())
+    {
+        std::fprintf(stderr, "board hash does not match a full rehash\n");
+        return 1;
+    }
+    return 0;
+}